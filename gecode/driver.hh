@@ -388,6 +388,7 @@ namespace Gecode {
     Driver::DoubleOption      _threads;       ///< How many threads to use
     Driver::UnsignedIntOption _c_d;           ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;           ///< Adaptive recomputation distance
+    Driver::BoolOption        _handover;      ///< Whether to hand over copies when stealing
     Driver::UnsignedIntOption _d_l;           ///< Discrepancy limit for LDS
     Driver::UnsignedIntOption _node;          ///< Cutoff for number of nodes
     Driver::UnsignedIntOption _fail;          ///< Cutoff for number of failures
@@ -399,6 +400,7 @@ namespace Gecode {
     Driver::UnsignedIntOption _r_scale;       ///< Restart scale factor
     Driver::BoolOption        _nogoods;       ///< Whether to use no-goods
     Driver::UnsignedIntOption _nogoods_limit; ///< Limit for no-good extraction
+    Driver::UnsignedIntOption _nogoods_activity; ///< Activity of no-goods
     Driver::DoubleOption      _relax;         ///< Probability to relax variable
     Driver::BoolOption        _interrupt;     ///< Whether to catch SIGINT
     //@}
@@ -505,6 +507,11 @@ namespace Gecode {
     /// Return adaptive recomputation distance
     unsigned int a_d(void) const;
 
+    /// Set default whether to hand over copies when stealing
+    void handover(bool b);
+    /// Return whether to hand over copies when stealing
+    bool handover(void) const;
+
     /// Set default discrepancy limit for LDS
     void d_l(unsigned int d);
     /// Return discrepancy limit for LDS
@@ -560,6 +567,11 @@ namespace Gecode {
     /// Return depth limit for nogoods
     unsigned int nogoods_limit(void) const;
 
+    /// Set default activity of nogoods before deletion
+    void nogoods_activity(unsigned int a);
+    /// Return activity of nogoods before deletion
+    unsigned int nogoods_activity(void) const;
+
     /// Set default relax probability
     void relax(double d);
     /// Return default relax probability
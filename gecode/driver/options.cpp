@@ -586,6 +586,8 @@ namespace Gecode {
                Search::Config::threads),
       _c_d("c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("a-d","recomputation adaptation distance",Search::Config::a_d),
+      _handover("handover","whether to hand over copies when stealing work",
+                Search::Config::handover),
       _d_l("d-l","discrepancy limit for LDS",Search::Config::d_l),
       _node("node","node cutoff (0 = none, solution mode)"),
       _fail("fail","failure cutoff (0 = none, solution mode)"),
@@ -600,6 +602,8 @@ namespace Gecode {
       _nogoods("nogoods","whether to use no-goods from restarts",false),
       _nogoods_limit("nogoods-limit","depth limit for no-good extraction",
                      Search::Config::nogoods_limit),
+      _nogoods_activity("nogoods-activity",
+                        "activity of no-goods before deletion (0: keep)",0),
       _relax("relax","probability for relaxing variable", 0.0),
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
@@ -640,11 +644,12 @@ namespace Gecode {
     add(_model); add(_symmetry); add(_propagation); add(_ipl);
     add(_branching); add(_decay); add(_seed); add(_step);
     add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
+    add(_handover);
     add(_d_l);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_assets); add(_slice);
     add(_restart); add(_r_base); add(_r_scale);
-    add(_nogoods); add(_nogoods_limit);
+    add(_nogoods); add(_nogoods_limit); add(_nogoods_activity);
     add(_relax);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
     add(_out_file); add(_log_file); add(_trace);
@@ -319,6 +319,15 @@ namespace Gecode {
     return _a_d.value();
   }
 
+  inline void
+  Options::handover(bool b) {
+    _handover.value(b);
+  }
+  inline bool
+  Options::handover(void) const {
+    return _handover.value();
+  }
+
   inline void
   Options::d_l(unsigned int d) {
     _d_l.value(d);
@@ -418,6 +427,15 @@ namespace Gecode {
     return _nogoods_limit.value();
   }
 
+  inline void
+  Options::nogoods_activity(unsigned int a) {
+    _nogoods_activity.value(a);
+  }
+  inline unsigned int
+  Options::nogoods_activity(void) const {
+    return _nogoods_activity.value();
+  }
+
   inline void
   Options::relax(double d) {
     _relax.value(d);
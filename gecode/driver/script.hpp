@@ -376,6 +376,7 @@ namespace Gecode { namespace Driver {
           so.threads = o.threads();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.handover = o.handover();
           so.d_l     = o.d_l();
           so.assets  = o.assets();
           so.slice   = o.slice();
@@ -384,6 +385,7 @@ namespace Gecode { namespace Driver {
           so.cutoff  = createCutoff(o);
           so.clone   = false;
           so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+          so.nogoods_activity = o.nogoods_activity();
           if (o.interrupt())
             CombinedStop::installCtrlHandler(true);
           {
@@ -476,11 +478,13 @@ namespace Gecode { namespace Driver {
           so.slice   = o.slice();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.handover = o.handover();
           so.d_l     = o.d_l();
           so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
                                             o.interrupt());
           so.cutoff  = createCutoff(o);
           so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+          so.nogoods_activity = o.nogoods_activity();
           if (o.interrupt())
             CombinedStop::installCtrlHandler(true);
           {
@@ -536,11 +540,14 @@ namespace Gecode { namespace Driver {
               so.slice   = o.slice();
               so.c_d     = o.c_d();
               so.a_d     = o.a_d();
+              so.handover = o.handover();
+          so.handover = o.handover();
               so.d_l     = o.d_l();
               so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
                                                 false);
               so.cutoff  = createCutoff(o);
               so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+              so.nogoods_activity = o.nogoods_activity();
               {
                 Meta<Script,Engine> e(s1,so);
                 do {
@@ -435,6 +435,13 @@ namespace Gecode { namespace FlatZinc {
       return BOOL_VAL_MAX();
     case IntValBranch::SEL_RND:
       return BOOL_VAL_RND(ivb.rnd());
+    case IntValBranch::SEL_SOL_MIN:
+    case IntValBranch::SEL_SOL_MED:
+      return BOOL_VAL_SOL_MIN();
+    case IntValBranch::SEL_SOL_MAX:
+      return BOOL_VAL_SOL_MAX();
+    case IntValBranch::SEL_SOL_RND:
+      return BOOL_VAL_SOL_RND(ivb.rnd());
     case IntValBranch::SEL_VAL_COMMIT:
     default:
     GECODE_NEVER;
@@ -1825,7 +1825,10 @@ namespace Gecode {
       SEL_SPLIT_MIN, ///< Select values not greater than mean of smallest and largest value
       SEL_SPLIT_MAX, ///< Select values greater than mean of smallest and largest value
       SEL_SPLIT_RND,  ///< Select values randomly which are not greater or not smaller than mean of largest and smallest value
-      SEL_VAL_COMMIT  ///< Select value according to user-defined functions
+      SEL_VAL_COMMIT, ///< Select value according to user-defined functions
+      SEL_SOL_SPLIT_MIN, ///< Select half containing value from last solution, otherwise as SEL_SPLIT_MIN
+      SEL_SOL_SPLIT_MAX, ///< Select half containing value from last solution, otherwise as SEL_SPLIT_MAX
+      SEL_SOL_SPLIT_RND  ///< Select half containing value from last solution, otherwise as SEL_SPLIT_RND
     };
   protected:
     /// Which value to select
@@ -1835,6 +1838,8 @@ namespace Gecode {
     FloatValBranch(Select s = SEL_SPLIT_MIN);
     /// Initialize with random number generator \a r
     FloatValBranch(Rnd r);
+    /// Initialize with selection strategy \a s and random number generator \a r
+    FloatValBranch(Select s, Rnd r);
     /// Initialize with value function \a f and commit function \a c
     FloatValBranch(FloatBranchVal v, FloatBranchCommit c);
     /// Return selection strategy
@@ -1859,6 +1864,20 @@ namespace Gecode {
    * alternative and that \a x must be greater or equal than \a n otherwise.
    */
   FloatValBranch FLOAT_VAL(FloatBranchVal v, FloatBranchCommit c=nullptr);
+  /**
+   * \brief Select the half containing the value in the last solution found
+   *
+   * If the value of the variable in the last solution is still in the
+   * domain, the half of the domain containing it is tried first.
+   * Otherwise, values not greater than mean of smallest and largest
+   * value are selected. The values are shared by all copies of the
+   * brancher, this includes restarts and parallel search.
+   */
+  FloatValBranch FLOAT_VAL_SOL_SPLIT_MIN(void);
+  /// Select half containing value from last solution, otherwise values greater than mean of smallest and largest value
+  FloatValBranch FLOAT_VAL_SOL_SPLIT_MAX(void);
+  /// Select half containing value from last solution, otherwise values randomly which are not greater or not smaller than mean of largest and smallest value
+  FloatValBranch FLOAT_VAL_SOL_SPLIT_RND(Rnd r);
   //@}
 
 }
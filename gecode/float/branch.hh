@@ -275,6 +275,38 @@ namespace Gecode { namespace Float { namespace Branch {
     void dispose(Space& home);
   };
 
+  /**
+   * \brief Value selection class for half containing value in last solution
+   *
+   * If the value of the view in the last solution is still in the
+   * domain, the half of the domain containing it is selected. Otherwise,
+   * the value is selected by \a Fallback.
+   *
+   * Requires \code #include <gecode/float/branch.hh> \endcode
+   * \ingroup FuncFloatValSel
+   */
+  template<class Fallback>
+  class ValSelSol : public ValSel<FloatView,FloatNumBranch> {
+  protected:
+    /// The fallback value selection
+    Fallback f;
+    /// The values from the last solution
+    SolutionValues<FloatVal> sv;
+  public:
+    /// Constructor for initialization
+    ValSelSol(Space& home, const ValBranch<Var>& vb);
+    /// Constructor for cloning
+    ValSelSol(Space& home, ValSelSol& vs);
+    /// Return value of view \a x at position \a i
+    FloatNumBranch val(const Space& home, FloatView x, int i);
+    /// Remember the values of the views \a x in a solution
+    void solved(const Space& home, const ViewArray<FloatView>& x);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Delete value selection
+    void dispose(Space& home);
+  };
+
 }}}
 
 #include <gecode/float/branch/val-sel.hpp>
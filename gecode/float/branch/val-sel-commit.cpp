@@ -56,6 +56,15 @@ namespace Gecode { namespace Float { namespace Branch {
         return new (home)
           ValSelCommit<ValSelFunction<FloatView>,ValCommitFunction<FloatView> >(home,fvb);
       }
+    case FloatValBranch::SEL_SOL_SPLIT_MIN:
+      return new (home)
+        ValSelCommit<ValSelSol<ValSelLq>,ValCommitLqGq>(home,fvb);
+    case FloatValBranch::SEL_SOL_SPLIT_MAX:
+      return new (home)
+        ValSelCommit<ValSelSol<ValSelGq>,ValCommitLqGq>(home,fvb);
+    case FloatValBranch::SEL_SOL_SPLIT_RND:
+      return new (home)
+        ValSelCommit<ValSelSol<ValSelRnd>,ValCommitLqGq>(home,fvb);
     default:
       throw UnknownBranching("Float::branch");
     }
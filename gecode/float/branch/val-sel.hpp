@@ -101,6 +101,45 @@ namespace Gecode { namespace Float { namespace Branch {
     r.~Rnd();
   }
 
+  template<class Fallback>
+  forceinline
+  ValSelSol<Fallback>::ValSelSol(Space& home, const ValBranch<Var>& vb)
+    : ValSel<FloatView,FloatNumBranch>(home,vb), f(home,vb) {}
+  template<class Fallback>
+  forceinline
+  ValSelSol<Fallback>::ValSelSol(Space& home, ValSelSol& vs)
+    : ValSel<FloatView,FloatNumBranch>(home,vs), f(home,vs.f), sv(vs.sv) {}
+  template<class Fallback>
+  forceinline FloatNumBranch
+  ValSelSol<Fallback>::val(const Space& home, FloatView x, int i) {
+    FloatVal v;
+    if (sv.get(i,v)) {
+      FloatNum n = v.med();
+      if ((x.min() <= n) && (n <= x.max())) {
+        FloatNumBranch nl;
+        nl.n = x.med(); nl.l = (n <= nl.n);
+        return nl;
+      }
+    }
+    return f.val(home,x,i);
+  }
+  template<class Fallback>
+  forceinline void
+  ValSelSol<Fallback>::solved(const Space&, const ViewArray<FloatView>& x) {
+    sv.update(x);
+  }
+  template<class Fallback>
+  forceinline bool
+  ValSelSol<Fallback>::notice(void) const {
+    return true;
+  }
+  template<class Fallback>
+  forceinline void
+  ValSelSol<Fallback>::dispose(Space& home) {
+    f.dispose(home);
+    sv.~SolutionValues<FloatVal>();
+  }
+
 }}}
 
 // STATISTICS: float-branch
@@ -45,6 +45,10 @@ namespace Gecode {
   FloatValBranch::FloatValBranch(Rnd r)
     : ValBranch<FloatVar>(r), s(SEL_SPLIT_RND) {}
 
+  forceinline
+  FloatValBranch::FloatValBranch(Select s0, Rnd r)
+    : ValBranch<FloatVar>(r), s(s0) {}
+
   forceinline
   FloatValBranch::FloatValBranch(FloatBranchVal v, FloatBranchCommit c)
     : ValBranch<FloatVar>(v,c), s(SEL_VAL_COMMIT) {}
@@ -75,6 +79,21 @@ namespace Gecode {
     return FloatValBranch(v,c);
   }
 
+  inline FloatValBranch
+  FLOAT_VAL_SOL_SPLIT_MIN(void) {
+    return FloatValBranch(FloatValBranch::SEL_SOL_SPLIT_MIN);
+  }
+
+  inline FloatValBranch
+  FLOAT_VAL_SOL_SPLIT_MAX(void) {
+    return FloatValBranch(FloatValBranch::SEL_SOL_SPLIT_MAX);
+  }
+
+  inline FloatValBranch
+  FLOAT_VAL_SOL_SPLIT_RND(Rnd r) {
+    return FloatValBranch(FloatValBranch::SEL_SOL_SPLIT_RND,r);
+  }
+
 }
 
 // STATISTICS: float-branch
@@ -108,17 +108,17 @@ namespace Gecode { namespace Float { namespace Branch {
       case FloatVarBranch::SEL_MERIT_MAX:
         return new (home) ViewSelMax<MeritFunction<FloatView>>(home,fvb);
       case FloatVarBranch::SEL_MIN_MIN:
-        return new (home) ViewSelMin<MeritMin>(home,fvb);
+        return new (home) ViewSelMinHeap<MeritMin>(home,fvb);
       case FloatVarBranch::SEL_MIN_MAX:
-        return new (home) ViewSelMax<MeritMin>(home,fvb);
+        return new (home) ViewSelMaxHeap<MeritMin>(home,fvb);
       case FloatVarBranch::SEL_MAX_MIN:
-        return new (home) ViewSelMin<MeritMax>(home,fvb);
+        return new (home) ViewSelMinHeap<MeritMax>(home,fvb);
       case FloatVarBranch::SEL_MAX_MAX:
-        return new (home) ViewSelMax<MeritMax>(home,fvb);
+        return new (home) ViewSelMaxHeap<MeritMax>(home,fvb);
       case FloatVarBranch::SEL_SIZE_MIN:
-        return new (home) ViewSelMin<MeritSize>(home,fvb);
+        return new (home) ViewSelMinHeap<MeritSize>(home,fvb);
       case FloatVarBranch::SEL_SIZE_MAX:
-        return new (home) ViewSelMax<MeritSize>(home,fvb);
+        return new (home) ViewSelMaxHeap<MeritSize>(home,fvb);
       case FloatVarBranch::SEL_DEGREE_MIN:
         return new (home) ViewSelMin<MeritDegree<FloatView>>(home,fvb);
       case FloatVarBranch::SEL_DEGREE_MAX:
@@ -2350,6 +2350,119 @@ namespace Gecode {
 
 #include <gecode/int/extensional/tuple-set.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Multi-valued decision diagram (%MDD)
+   *
+   * An %MDD of arity \f$n\f$ has \f$n+1\f$ layers of nodes. Layer
+   * \f$0\f$ contains the root node and layer \f$n\f$ contains the
+   * terminal node. Nodes are numbered per layer and both the root and
+   * the terminal node have number \f$0\f$. Each edge leads from a
+   * node in layer \f$i\f$ to a node in layer \f$i+1\f$ and is labeled
+   * with a value for the \f$i\f$-th variable. A tuple belongs to the
+   * %MDD, if it is the label sequence of a path from the root node to
+   * the terminal node.
+   *
+   * An %MDD is always reduced: nodes that are not on a path from the
+   * root to the terminal node are removed and nodes of the same layer
+   * with the same outgoing edges (isomorphic nodes) are merged.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  class MDD : public SharedHandle {
+  public:
+    /// Specification of an %MDD edge
+    class Edge {
+    public:
+      int layer;  ///< layer of in-node
+      int i_node; ///< in-node (number in layer \a layer)
+      int val;    ///< value
+      int o_node; ///< out-node (number in layer \a layer + 1)
+      /// Default constructor
+      Edge(void);
+      /// Initialize members
+      Edge(int layer0, int i_node0, int val0, int o_node0);
+    };
+  private:
+    /// Implementation of MDD
+    class MDDI;
+    /// Initialize from \a n_e edges \a e for arity \a n (edges are modified)
+    void init(int n, Edge* e, int n_e);
+  public:
+    /// Iterator for the edges of a layer (sorted by values)
+    class Edges {
+    private:
+      /// Current edge
+      const Edge* c_edge;
+      /// End of edges
+      const Edge* e_edge;
+    public:
+      /// Initialize to all edges of layer \a l of %MDD \a m
+      Edges(const MDD& m, int l);
+      /// Initialize to edges of layer \a l of %MDD \a m for value \a n
+      Edges(const MDD& m, int l, int n);
+      /// Test whether iterator still at an edge
+      bool operator ()(void) const;
+      /// Move iterator to next edge
+      void operator ++(void);
+      /// Return in-node of current edge
+      int i_node(void) const;
+      /// Return value of current edge
+      int val(void) const;
+      /// Return out-node of current edge
+      int o_node(void) const;
+    };
+    friend class Edges;
+    /// Initialize as %MDD of arity zero (accepting the empty tuple)
+    MDD(void);
+    /**
+     * \brief Initialize %MDD of arity \a n from edges \a e
+     *
+     * The last element of \a e must have -1 as value for \c layer.
+     * Nodes can be numbered arbitrarily (but non-negative) within each
+     * layer, the root and terminal node must have number \f$0\f$.
+     *
+     * Throws an exception of type Int::OutOfLimits, if a value exceeds
+     * the limits for integers or a layer or node is out of range.
+     */
+    GECODE_INT_EXPORT
+    MDD(int n, const Edge e[]);
+    /**
+     * \brief Initialize with tuples of tuple set \a ts
+     *
+     * Throws an exception of type Int::NotYetFinalized, if \a ts has not
+     * been finalized.
+     */
+    GECODE_INT_EXPORT
+    explicit MDD(const TupleSet& ts);
+    /// Initialize with words of length \a n accepted by DFA \a d
+    GECODE_INT_EXPORT
+    MDD(int n, const DFA& d);
+    /// Initialize by %MDD \a m (%MDD is shared)
+    MDD(const MDD& m);
+    /// Return arity
+    int arity(void) const;
+    /// Return number of nodes
+    int n_nodes(void) const;
+    /// Return number of edges
+    int n_edges(void) const;
+    /// Return number of nodes of layer \a l
+    int width(int l) const;
+    /// Return maximal number of nodes of any layer
+    int max_width(void) const;
+    /// Return maximal degree of any node and maximal number of edges per layer and value
+    unsigned int max_degree(void) const;
+    /// Return smallest value
+    int min(void) const;
+    /// Return largest value
+    int max(void) const;
+  };
+
+}
+
+#include <gecode/int/extensional/mdd.hpp>
+
 namespace Gecode {
 
   /**
@@ -2411,6 +2524,38 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   extensional(Home home, const BoolVarArgs& x, const TupleSet& t,
               IntPropLevel ipl=IPL_DEF);
+
+  /**
+   * \brief Post domain consistent propagator for extensional constraint described by an %MDD
+   *
+   * The elements of \a x must be a tuple of the %MDD \a m.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x and
+   * \a m are of different arity, and of type Int::ArgumentSame, if \a x
+   * contains the same unassigned variable multiply. If shared occurences
+   * of variables are required, unshare should be used.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT void
+  extensional(Home home, const IntVarArgs& x, const MDD& m,
+              IntPropLevel ipl=IPL_DEF);
+
+  /**
+   * \brief Post domain consistent propagator for extensional constraint described by an %MDD
+   *
+   * The elements of \a x must be a tuple of the %MDD \a m.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x and
+   * \a m are of different arity, and of type Int::ArgumentSame, if \a x
+   * contains the same unassigned variable multiply. If shared occurences
+   * of variables are required, unshare should be used.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT void
+  extensional(Home home, const BoolVarArgs& x, const MDD& m,
+              IntPropLevel ipl=IPL_DEF);
 }
 
 namespace Gecode {
@@ -3602,6 +3747,10 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x.
+   * If \a ipl includes IPL_BASIC, the check whether the graph is
+   * strongly connected is only re-run when an edge of a stored
+   * certificate of strong connectivity has been removed. This is
+   * considerably cheaper for large graphs but might propagate less.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
@@ -3619,6 +3768,10 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x.
+   * If \a ipl includes IPL_BASIC, the check whether the graph is
+   * strongly connected is only re-run when an edge of a stored
+   * certificate of strong connectivity has been removed. This is
+   * considerably cheaper for large graphs but might propagate less.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
@@ -3739,6 +3892,10 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x.
+   * If \a ipl includes IPL_BASIC, the check whether the graph is
+   * strongly connected is only re-run when an edge of a stored
+   * certificate of strong connectivity has been removed. This is
+   * considerably cheaper for large graphs but might propagate less.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
@@ -3758,6 +3915,10 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x.
+   * If \a ipl includes IPL_BASIC, the check whether the graph is
+   * strongly connected is only re-run when an edge of a stored
+   * certificate of strong connectivity has been removed. This is
+   * considerably cheaper for large graphs but might propagate less.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
@@ -4662,7 +4823,11 @@ namespace Gecode {
       SEL_RANGE_MAX,  ///< Select the largest range of the variable domain if it has several ranges, otherwise select values greater than mean of smallest and largest value
       SEL_VAL_COMMIT, ///< Select value according to user-defined functions
       SEL_VALUES_MIN, ///< Select all values starting from smallest
-      SEL_VALUES_MAX  ///< Select all values starting from largest
+      SEL_VALUES_MAX, ///< Select all values starting from largest
+      SEL_SOL_MIN,    ///< Select value from last solution, otherwise smallest value
+      SEL_SOL_MED,    ///< Select value from last solution, otherwise greatest value not greater than the median
+      SEL_SOL_MAX,    ///< Select value from last solution, otherwise largest value
+      SEL_SOL_RND     ///< Select value from last solution, otherwise random value
    };
   protected:
     /// Which value to select
@@ -4672,6 +4837,8 @@ namespace Gecode {
     IntValBranch(Select s = SEL_MIN);
     /// Initialize with random number generator \a r
     IntValBranch(Rnd r);
+    /// Initialize with selection strategy \a s and random number generator \a r
+    IntValBranch(Select s, Rnd r);
     /// Initialize with value function \a f and commit function \a c
     IntValBranch(IntBranchVal v, IntBranchCommit c);
     /// Return selection strategy
@@ -4687,10 +4854,13 @@ namespace Gecode {
   public:
     /// Which value selection
     enum Select {
-      SEL_MIN,       ///< Select smallest value
-      SEL_MAX,       ///< Select largest value
-      SEL_RND,       ///< Select random value
-      SEL_VAL_COMMIT ///< Select value according to user-defined functions
+      SEL_MIN,        ///< Select smallest value
+      SEL_MAX,        ///< Select largest value
+      SEL_RND,        ///< Select random value
+      SEL_VAL_COMMIT, ///< Select value according to user-defined functions
+      SEL_SOL_MIN,    ///< Select value from last solution, otherwise smallest value
+      SEL_SOL_MAX,    ///< Select value from last solution, otherwise largest value
+      SEL_SOL_RND     ///< Select value from last solution, otherwise random value
    };
   protected:
     /// Which value to select
@@ -4700,6 +4870,8 @@ namespace Gecode {
     BoolValBranch(Select s = SEL_MIN);
     /// Initialize with random number generator \a r
     BoolValBranch(Rnd r);
+    /// Initialize with selection strategy \a s and random number generator \a r
+    BoolValBranch(Select s, Rnd r);
     /// Initialize with value function \a f and commit function \a c
     BoolValBranch(BoolBranchVal v, BoolBranchCommit c);
     /// Return selection strategy
@@ -4738,6 +4910,21 @@ namespace Gecode {
   IntValBranch INT_VALUES_MIN(void);
   /// Try all values starting from largest
   IntValBranch INT_VALUES_MAX(void);
+  /**
+   * \brief Select value of the variable in the last solution found
+   *
+   * The value is used as long as it is still in the domain of the
+   * variable, otherwise the smallest value is selected. The values
+   * are shared by all copies of the brancher, this includes
+   * restarts and parallel search.
+   */
+  IntValBranch INT_VAL_SOL_MIN(void);
+  /// Select value from last solution, otherwise greatest value not greater than the median
+  IntValBranch INT_VAL_SOL_MED(void);
+  /// Select value from last solution, otherwise largest value
+  IntValBranch INT_VAL_SOL_MAX(void);
+  /// Select value from last solution, otherwise random value
+  IntValBranch INT_VAL_SOL_RND(Rnd r);
 
   /// Select smallest value
   BoolValBranch BOOL_VAL_MIN(void);
@@ -4752,6 +4939,12 @@ namespace Gecode {
    * and that \a x must be different from \a n for the second alternative.
    */
   BoolValBranch BOOL_VAL(BoolBranchVal v, BoolBranchCommit c=nullptr);
+  /// Select value from last solution, otherwise smallest value
+  BoolValBranch BOOL_VAL_SOL_MIN(void);
+  /// Select value from last solution, otherwise largest value
+  BoolValBranch BOOL_VAL_SOL_MAX(void);
+  /// Select value from last solution, otherwise random value
+  BoolValBranch BOOL_VAL_SOL_RND(Rnd r);
   //@}
 
 }
@@ -5186,6 +5379,100 @@ namespace Gecode {
   relax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx,
         Rnd r, double p);
 
+  /*
+   * \brief Relaxed assignment of groups of variables in \a x from values in \a sx
+   *
+   * The variable \a x[i] belongs to the group \a g[i]. Each group is
+   * relaxed with probability \a p: all variables of a group that is not
+   * relaxed are assigned values from the assigned variables in the
+   * solution \a sx. This allows to relax structurally related variables
+   * (for example, all tasks on a machine) together.
+   *
+   * The random numbers are generated from the generator \a r. At least
+   * one group will be relaxed.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x,
+   * \a sx, and \a g are of different size.
+   *
+   * Throws an exception of type Int::OutOfLimits, if \a p is not between
+   * \a 0.0 and \a 1.0 or if \a g contains a negative group.
+   *
+   * \ingroup TaskModelInt
+   */
+  GECODE_INT_EXPORT void
+  relax(Home home, const IntVarArgs& x, const IntVarArgs& sx,
+        const IntArgs& g, Rnd r, double p);
+
+  /*
+   * \brief Relaxed assignment of groups of variables in \a x from values in \a sx
+   *
+   * The variable \a x[i] belongs to the group \a g[i]. Each group is
+   * relaxed with probability \a p: all variables of a group that is not
+   * relaxed are assigned values from the assigned variables in the
+   * solution \a sx. This allows to relax structurally related variables
+   * (for example, all tasks on a machine) together.
+   *
+   * The random numbers are generated from the generator \a r. At least
+   * one group will be relaxed.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x,
+   * \a sx, and \a g are of different size.
+   *
+   * Throws an exception of type Int::OutOfLimits, if \a p is not between
+   * \a 0.0 and \a 1.0 or if \a g contains a negative group.
+   *
+   * \ingroup TaskModelInt
+   */
+  GECODE_INT_EXPORT void
+  relax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx,
+        const IntArgs& g, Rnd r, double p);
+
+  /*
+   * \brief Propagation-guided relaxed assignment of variables in \a x
+   *
+   * The variables in \a x are assigned values from the assigned variables
+   * in the solution \a sx in an order chosen by the generator \a r,
+   * performing constraint propagation after each assignment. Assignment
+   * stops as soon as at most a fraction \a p of the variables (but at
+   * least one) remains unassigned. Variables assigned by propagation are
+   * not assigned explicitly, hence the relaxed variables tend to be
+   * those that are closely related by the constraints.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x and
+   * \a sx are of different size.
+   *
+   * Throws an exception of type Int::OutOfLimits, if \a p is not between
+   * \a 0.0 and \a 1.0.
+   *
+   * \ingroup TaskModelInt
+   */
+  GECODE_INT_EXPORT void
+  pgrelax(Home home, const IntVarArgs& x, const IntVarArgs& sx,
+          Rnd r, double p);
+
+  /*
+   * \brief Propagation-guided relaxed assignment of variables in \a x
+   *
+   * The variables in \a x are assigned values from the assigned variables
+   * in the solution \a sx in an order chosen by the generator \a r,
+   * performing constraint propagation after each assignment. Assignment
+   * stops as soon as at most a fraction \a p of the variables (but at
+   * least one) remains unassigned. Variables assigned by propagation are
+   * not assigned explicitly, hence the relaxed variables tend to be
+   * those that are closely related by the constraints.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x and
+   * \a sx are of different size.
+   *
+   * Throws an exception of type Int::OutOfLimits, if \a p is not between
+   * \a 0.0 and \a 1.0.
+   *
+   * \ingroup TaskModelInt
+   */
+  GECODE_INT_EXPORT void
+  pgrelax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx,
+          Rnd r, double p);
+
 }
 
 
@@ -132,6 +132,42 @@ namespace Gecode { namespace Int { namespace BinPacking {
   };
 
 
+  /**
+   * \brief Sets of reachable sums
+   *
+   * Stores which sums between \f$0\f$ and some capacity \f$c\f$ can
+   * be obtained by a subset of the added sizes. The sums are stored as
+   * a bitset, adding a size shifts the bitset and merges it with itself
+   * which processes as many sums as a word has bits at a time.
+   */
+  class SumSet {
+  protected:
+    /// Type for words
+    typedef unsigned long long int Word;
+    /// Bits per word
+    static const int bpw = static_cast<int>(CHAR_BIT * sizeof(Word));
+    /// Largest sum to be considered
+    int c;
+    /// Number of words
+    int n;
+    /// The bits for sums
+    Word* w;
+  public:
+    /// Allocate for sums up to \a c_max
+    SumSet(Region& region, int c_max);
+    /// Initialize with the empty sum only for sums up to \a c <= \a c_max
+    void init(int c);
+    /// Add size \a s
+    void add(int s);
+    /// Test whether sum \a s is reachable
+    bool in(int s) const;
+    /// Return smallest reachable sum greater or equal to \a a (or \a c+1)
+    int geq(int a) const;
+    /// Return largest reachable sum less or equal to \a b (or -1)
+    int leq(int b) const;
+  };
+
+
   /**
    * \brief Bin-packing propagator
    *
@@ -150,6 +186,8 @@ namespace Gecode { namespace Int { namespace BinPacking {
     ViewArray<Item> bs;
     /// Total size of all items
     int t;
+    /// Largest load of a bin for which the reachable sums are computed
+    static const int sums_max = 64 * 64;
     /// Constructor for posting
     Pack(Home home, ViewArray<OffsetView>& l, ViewArray<Item>& bs);
     /// Constructor for cloning \a p
@@ -234,7 +234,29 @@ namespace Gecode { namespace Int { namespace BinPacking {
           s[j.val()].add(bs[i].size());
       }
 
+      // Reachable sums for bins with small loads
+      SumSet ss(region,sums_max);
+
       for (int j=m; j--; ) {
+        const SizeSet& sj = s[j];
+        int c = std::min(l[j].max(),sj.total());
+        if (c <= sums_max) {
+          // Compute sums the items for the bin can reach, stop as soon
+          // as both load bounds are reachable
+          ss.init(c);
+          for (int i=sj.card(); i--; ) {
+            ss.add(sj[i]);
+            if (ss.in(l[j].min()) && ss.in(l[j].max()))
+              break;
+          }
+          // Adjust load to closest reachable sums
+          int a = ss.geq(l[j].min());
+          if (a > c)
+            return ES_FAILED;
+          GECODE_ME_CHECK(l[j].gq(home,a));
+          GECODE_ME_CHECK(l[j].lq(home,ss.leq(l[j].max())));
+          continue;
+        }
         // Can items still be packed into bin?
         if (nosum(static_cast<SizeSet&>(s[j]), l[j].min(), l[j].max()))
           return ES_FAILED;
@@ -146,6 +146,73 @@ namespace Gecode { namespace Int { namespace BinPacking {
 
 
 
+  /*
+   * Sum set
+   *
+   */
+  forceinline
+  SumSet::SumSet(Region& region, int c_max)
+    : c(0), n(0), w(region.alloc<Word>(c_max / bpw + 1)) {}
+  forceinline void
+  SumSet::init(int c0) {
+    c = c0; n = c / bpw + 1;
+    for (int i=n; i--; )
+      w[i] = 0;
+    w[0] = 1;
+  }
+  forceinline void
+  SumSet::add(int s) {
+    if ((s <= 0) || (s > c))
+      return;
+    // Shift by s and merge, words are processed from the top
+    int ws = s / bpw, bs = s % bpw;
+    if (bs == 0) {
+      for (int i=n; i-- > ws; )
+        w[i] |= w[i-ws];
+    } else {
+      for (int i=n; i-- > ws+1; )
+        w[i] |= (w[i-ws] << bs) | (w[i-ws-1] >> (bpw-bs));
+      w[ws] |= w[0] << bs;
+    }
+    // Discard sums larger than c
+    w[n-1] &= ~static_cast<Word>(0) >> (bpw - 1 - c % bpw);
+  }
+  forceinline bool
+  SumSet::in(int s) const {
+    return (s >= 0) && (s <= c) && (((w[s / bpw] >> (s % bpw)) & 1) != 0);
+  }
+  forceinline int
+  SumSet::geq(int a) const {
+    int s = std::max(a,0);
+    while (s <= c) {
+      Word v = w[s / bpw] >> (s % bpw);
+      if (v != 0) {
+        while ((v & 1) == 0) {
+          v >>= 1; s++;
+        }
+        return s;
+      }
+      s = (s / bpw + 1) * bpw;
+    }
+    return c+1;
+  }
+  forceinline int
+  SumSet::leq(int b) const {
+    int s = std::min(b,c);
+    while (s >= 0) {
+      Word v = w[s / bpw] << (bpw - 1 - s % bpw);
+      if (v != 0) {
+        while ((v >> (bpw - 1)) == 0) {
+          v <<= 1; s--;
+        }
+        return s;
+      }
+      s = (s / bpw) * bpw - 1;
+    }
+    return -1;
+  }
+
+
   /*
    * Packing propagator
    *
@@ -400,6 +400,38 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(const Space& home, IntView x, int i);
   };
 
+  /**
+   * \brief Value selection class for value of view in last solution
+   *
+   * If the value of the view in the last solution is still in the
+   * domain, it is selected. Otherwise, the value is selected by \a Fallback.
+   *
+   * Requires \code #include <gecode/int/branch.hh> \endcode
+   * \ingroup FuncIntValSel
+   */
+  template<class View, class Fallback>
+  class ValSelSol : public ValSel<View,int> {
+    using typename ValSel<View,int>::Var;
+  protected:
+    /// The fallback value selection
+    Fallback f;
+    /// The values from the last solution
+    SolutionValues<int> sv;
+  public:
+    /// Constructor for initialization
+    ValSelSol(Space& home, const ValBranch<Var>& vb);
+    /// Constructor for cloning
+    ValSelSol(Space& home, ValSelSol& vs);
+    /// Return value of view \a x at position \a i
+    int val(const Space& home, View x, int i);
+    /// Remember the values of the views \a x in a solution
+    void solved(const Space& home, const ViewArray<View>& x);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Delete value selection
+    void dispose(Space& home);
+  };
+
 }}}
 
 #include <gecode/int/branch/val-sel.hpp>
@@ -76,6 +76,22 @@ namespace Gecode { namespace Int { namespace Branch {
         return new (home)
           ValSelCommit<ValSelFunction<IntView>,ValCommitFunction<IntView> >(home,ivb);
       }
+    case IntValBranch::SEL_SOL_MIN:
+      return new (home)
+        ValSelCommit<ValSelSol<IntView,ValSelMin<IntView> >,
+                     ValCommitEq<IntView> >(home,ivb);
+    case IntValBranch::SEL_SOL_MED:
+      return new (home)
+        ValSelCommit<ValSelSol<IntView,ValSelMed<IntView> >,
+                     ValCommitEq<IntView> >(home,ivb);
+    case IntValBranch::SEL_SOL_MAX:
+      return new (home)
+        ValSelCommit<ValSelSol<IntView,ValSelMax<IntView> >,
+                     ValCommitEq<IntView> >(home,ivb);
+    case IntValBranch::SEL_SOL_RND:
+      return new (home)
+        ValSelCommit<ValSelSol<IntView,ValSelRnd<IntView> >,
+                     ValCommitEq<IntView> >(home,ivb);
     default:
       throw UnknownBranching("Int::branch");
     }
@@ -129,6 +145,18 @@ namespace Gecode { namespace Int { namespace Branch {
         return new (home)
           ValSelCommit<ValSelFunction<BoolView>,ValCommitFunction<BoolView> >(home,bvb);
       }
+    case BoolValBranch::SEL_SOL_MIN:
+      return new (home)
+        ValSelCommit<ValSelSol<BoolView,ValSelMin<BoolView> >,
+                     ValCommitEq<BoolView> >(home,bvb);
+    case BoolValBranch::SEL_SOL_MAX:
+      return new (home)
+        ValSelCommit<ValSelSol<BoolView,ValSelMax<BoolView> >,
+                     ValCommitEq<BoolView> >(home,bvb);
+    case BoolValBranch::SEL_SOL_RND:
+      return new (home)
+        ValSelCommit<ValSelSol<BoolView,ValSelRnd<BoolView> >,
+                     ValCommitEq<BoolView> >(home,bvb);
     default:
       throw UnknownBranching("Int::branch");
     }
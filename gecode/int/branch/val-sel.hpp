@@ -161,6 +161,39 @@ namespace Gecode { namespace Int { namespace Branch {
     }
   }
 
+  template<class View, class Fallback>
+  forceinline
+  ValSelSol<View,Fallback>::ValSelSol(Space& home, const ValBranch<Var>& vb)
+    : ValSel<View,int>(home,vb), f(home,vb) {}
+  template<class View, class Fallback>
+  forceinline
+  ValSelSol<View,Fallback>::ValSelSol(Space& home, ValSelSol& vs)
+    : ValSel<View,int>(home,vs), f(home,vs.f), sv(vs.sv) {}
+  template<class View, class Fallback>
+  forceinline int
+  ValSelSol<View,Fallback>::val(const Space& home, View x, int i) {
+    int n;
+    if (sv.get(i,n) && x.in(n))
+      return n;
+    return f.val(home,x,i);
+  }
+  template<class View, class Fallback>
+  forceinline void
+  ValSelSol<View,Fallback>::solved(const Space&, const ViewArray<View>& x) {
+    sv.update(x);
+  }
+  template<class View, class Fallback>
+  forceinline bool
+  ValSelSol<View,Fallback>::notice(void) const {
+    return true;
+  }
+  template<class View, class Fallback>
+  forceinline void
+  ValSelSol<View,Fallback>::dispose(Space& home) {
+    f.dispose(home);
+    sv.~SolutionValues<int>();
+  }
+
 }}}
 
 // STATISTICS: int-branch
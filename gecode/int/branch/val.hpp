@@ -45,6 +45,10 @@ namespace Gecode {
   IntValBranch::IntValBranch(Rnd r)
     : ValBranch<IntVar>(r), s(SEL_RND) {}
 
+  forceinline
+  IntValBranch::IntValBranch(Select s0, Rnd r)
+    : ValBranch<IntVar>(r), s(s0) {}
+
   forceinline
   IntValBranch::IntValBranch(IntBranchVal v, IntBranchCommit c)
     : ValBranch<IntVar>(v,c), s(SEL_VAL_COMMIT) {}
@@ -110,6 +114,26 @@ namespace Gecode {
     return IntValBranch(IntValBranch::SEL_VALUES_MAX);
   }
 
+  inline IntValBranch
+  INT_VAL_SOL_MIN(void) {
+    return IntValBranch(IntValBranch::SEL_SOL_MIN);
+  }
+
+  inline IntValBranch
+  INT_VAL_SOL_MED(void) {
+    return IntValBranch(IntValBranch::SEL_SOL_MED);
+  }
+
+  inline IntValBranch
+  INT_VAL_SOL_MAX(void) {
+    return IntValBranch(IntValBranch::SEL_SOL_MAX);
+  }
+
+  inline IntValBranch
+  INT_VAL_SOL_RND(Rnd r) {
+    return IntValBranch(IntValBranch::SEL_SOL_RND,r);
+  }
+
 
 
   forceinline
@@ -120,6 +144,10 @@ namespace Gecode {
   BoolValBranch::BoolValBranch(Rnd r)
     : ValBranch<BoolVar>(r), s(SEL_RND) {}
 
+  forceinline
+  BoolValBranch::BoolValBranch(Select s0, Rnd r)
+    : ValBranch<BoolVar>(r), s(s0) {}
+
   forceinline
   BoolValBranch::BoolValBranch(BoolBranchVal v, BoolBranchCommit c)
     : ValBranch<BoolVar>(v,c), s(SEL_VAL_COMMIT) {}
@@ -150,6 +178,21 @@ namespace Gecode {
     return BoolValBranch(v,c);
   }
 
+  inline BoolValBranch
+  BOOL_VAL_SOL_MIN(void) {
+    return BoolValBranch(BoolValBranch::SEL_SOL_MIN);
+  }
+
+  inline BoolValBranch
+  BOOL_VAL_SOL_MAX(void) {
+    return BoolValBranch(BoolValBranch::SEL_SOL_MAX);
+  }
+
+  inline BoolValBranch
+  BOOL_VAL_SOL_RND(Rnd r) {
+    return BoolValBranch(BoolValBranch::SEL_SOL_RND,r);
+  }
+
 }
 
 // STATISTICS: int-branch
@@ -116,17 +116,17 @@ namespace Gecode { namespace Int { namespace Branch {
       case IntVarBranch::SEL_MERIT_MAX:
         return new (home) ViewSelMax<MeritFunction<IntView>>(home,ivb);
       case IntVarBranch::SEL_MIN_MIN:
-        return new (home) ViewSelMin<MeritMin<IntView>>(home,ivb);
+        return new (home) ViewSelMinHeap<MeritMin<IntView>>(home,ivb);
       case IntVarBranch::SEL_MIN_MAX:
-        return new (home) ViewSelMax<MeritMin<IntView>>(home,ivb);
+        return new (home) ViewSelMaxHeap<MeritMin<IntView>>(home,ivb);
       case IntVarBranch::SEL_MAX_MIN:
-        return new (home) ViewSelMin<MeritMax<IntView>>(home,ivb);
+        return new (home) ViewSelMinHeap<MeritMax<IntView>>(home,ivb);
       case IntVarBranch::SEL_MAX_MAX:
-        return new (home) ViewSelMax<MeritMax<IntView>>(home,ivb);
+        return new (home) ViewSelMaxHeap<MeritMax<IntView>>(home,ivb);
       case IntVarBranch::SEL_SIZE_MIN:
-        return new (home) ViewSelMin<MeritSize<IntView>>(home,ivb);
+        return new (home) ViewSelMinHeap<MeritSize<IntView>>(home,ivb);
       case IntVarBranch::SEL_SIZE_MAX:
-        return new (home) ViewSelMax<MeritSize<IntView>>(home,ivb);
+        return new (home) ViewSelMaxHeap<MeritSize<IntView>>(home,ivb);
       case IntVarBranch::SEL_DEGREE_MIN:
         return new (home) ViewSelMin<MeritDegree<IntView>>(home,ivb);
       case IntVarBranch::SEL_DEGREE_MAX:
@@ -177,7 +177,9 @@ namespace Gecode { namespace Int { namespace Channel {
   template<class View, class Offset, bool shared>
   forceinline
   Dom<View,Offset,shared>::Dom(Space& home, Dom<View,Offset,shared>& p)
-    : Base<DomInfo<View,Offset>,Offset,PC_INT_DOM>(home,p) {}
+    : Base<DomInfo<View,Offset>,Offset,PC_INT_DOM>(home,p) {
+    dc.update(home,p.dc);
+  }
 
   template<class View, class Offset, bool shared>
   Actor*
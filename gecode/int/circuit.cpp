@@ -50,26 +50,27 @@ namespace Gecode {
       throw Int::ArgumentSame("Int::circuit");
     GECODE_POST;
     ViewArray<Int::IntView> xv(home,x);
+    bool inc = (ba(ipl) & IPL_BASIC) != 0;
 
     if (offset == 0) {
       typedef Int::NoOffset<Int::IntView> NOV;
       NOV no;
       if (vbd(ipl) == IPL_DOM) {
         GECODE_ES_FAIL((Int::Circuit::Dom<Int::IntView,NOV>
-                        ::post(home,xv,no)));
+                        ::post(home,xv,no,inc)));
       } else {
         GECODE_ES_FAIL((Int::Circuit::Val<Int::IntView,NOV>
-                        ::post(home,xv,no)));
+                        ::post(home,xv,no,inc)));
       }
     } else {
       typedef Int::Offset OV;
       OV off(-offset);
       if (vbd(ipl) == IPL_DOM) {
         GECODE_ES_FAIL((Int::Circuit::Dom<Int::IntView,OV>
-                        ::post(home,xv,off)));
+                        ::post(home,xv,off,inc)));
       } else {
         GECODE_ES_FAIL((Int::Circuit::Val<Int::IntView,OV>
-                        ::post(home,xv,off)));
+                        ::post(home,xv,off,inc)));
       }
     }
   }
@@ -138,6 +139,7 @@ namespace Gecode {
     for (int i=n; i--; )
       xv[i] = Int::IntView(x[i]);
     xv[n] = s;
+    bool inc = (ba(ipl) & IPL_BASIC) != 0;
 
     if (offset == 0) {
       element(home, x, e, n);
@@ -145,10 +147,10 @@ namespace Gecode {
       NOV no;
       if (vbd(ipl) == IPL_DOM) {
         GECODE_ES_FAIL((Int::Circuit::Dom<Int::IntView,NOV>
-                        ::post(home,xv,no)));
+                        ::post(home,xv,no,inc)));
       } else {
         GECODE_ES_FAIL((Int::Circuit::Val<Int::IntView,NOV>
-                        ::post(home,xv,no)));
+                        ::post(home,xv,no,inc)));
       }
     } else {
       IntVarArgs ox(n+offset);
@@ -162,10 +164,10 @@ namespace Gecode {
       OV off(-offset);
       if (vbd(ipl) == IPL_DOM) {
         GECODE_ES_FAIL((Int::Circuit::Dom<Int::IntView,OV>
-                        ::post(home,xv,off)));
+                        ::post(home,xv,off,inc)));
       } else {
         GECODE_ES_FAIL((Int::Circuit::Val<Int::IntView,OV>
-                        ::post(home,xv,off)));
+                        ::post(home,xv,off,inc)));
       }
     }
   }
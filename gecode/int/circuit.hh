@@ -54,6 +54,12 @@ namespace Gecode { namespace Int { namespace Circuit {
    * Provides routines for checking that the induced variable value graph
    * is strongly connected and for pruning short cycles.
    *
+   * If the check is incremental, the propagator keeps a certificate of
+   * strong connectivity: an out-tree and an in-tree rooted at the same
+   * node. As long as all edges of the certificate remain in the
+   * graph, it is still strongly connected and the check (together
+   * with the pruning it performs) is skipped.
+   *
    */
   template<class View, class Offset>
   class Base : public NaryPropagator<View,Int::PC_INT_DOM> {
@@ -65,10 +71,22 @@ namespace Gecode { namespace Int { namespace Circuit {
     ViewArray<View> y;
     /// Offset transformation
     Offset o;
+    /// Root of the certificate (-1 if there is none)
+    int cr;
+    /**
+     * \brief Certificate for strong connectivity (NULL if not incremental)
+     *
+     * For each node \f$i\f$ other than the root, the graph has an edge
+     * from \f$c_i\f$ to \f$i\f$ (out-tree) and from \f$i\f$ to
+     * \f$c_{n+i}\f$ (in-tree).
+     */
+    int* c;
     /// Constructor for cloning \a p
     Base(Space& home, Base& p);
-    /// Constructor for posting
-    Base(Home home, ViewArray<View>& x, Offset& o);
+    /// Constructor for posting, \a inc defines whether check is incremental
+    Base(Home home, ViewArray<View>& x, Offset& o, bool inc);
+    /// Test whether the certificate is still valid
+    bool certified(void);
     /// Check whether the view value graph is strongly connected
     ExecStatus connected(Space& home);
     /// Ensure path property: prune edges that could give too small cycles
@@ -99,7 +117,7 @@ namespace Gecode { namespace Int { namespace Circuit {
     /// Constructor for cloning \a p
     Val(Space& home, Val& p);
     /// Constructor for posting
-    Val(Home home, ViewArray<View>& x, Offset& o);
+    Val(Home home, ViewArray<View>& x, Offset& o, bool inc);
   public:
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home);
@@ -107,8 +125,9 @@ namespace Gecode { namespace Int { namespace Circuit {
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator for circuit on \a x
-    static  ExecStatus post(Home home, ViewArray<View>& x, Offset& o);
+    /// Post propagator for circuit on \a x (\a inc: incremental check)
+    static  ExecStatus post(Home home, ViewArray<View>& x, Offset& o,
+                            bool inc=false);
   };
 
   /**
@@ -134,7 +153,7 @@ namespace Gecode { namespace Int { namespace Circuit {
     /// Constructor for cloning \a p
     Dom(Space& home, Dom& p);
     /// Constructor for posting
-    Dom(Home home, ViewArray<View>& x, Offset& o);
+    Dom(Home home, ViewArray<View>& x, Offset& o, bool inc);
   public:
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home);
@@ -149,8 +168,9 @@ namespace Gecode { namespace Int { namespace Circuit {
     virtual void reschedule(Space& home);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator for circuit on \a x
-    static  ExecStatus post(Home home, ViewArray<View>& x, Offset& o);
+    /// Post propagator for circuit on \a x (\a inc: incremental check)
+    static  ExecStatus post(Home home, ViewArray<View>& x, Offset& o,
+                            bool inc=false);
   };
 
 }}}
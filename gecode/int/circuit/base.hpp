@@ -39,18 +39,40 @@ namespace Gecode { namespace Int { namespace Circuit {
 
   template<class View, class Offset>
   forceinline
-  Base<View,Offset>::Base(Home home, ViewArray<View>& x, Offset& o0)
+  Base<View,Offset>::Base(Home home, ViewArray<View>& x, Offset& o0,
+                          bool inc)
     : NaryPropagator<View,Int::PC_INT_DOM>(home,x),
-      start(0), y(home,x), o(o0) {
+      start(0), y(home,x), o(o0), cr(-1),
+      c(inc ? static_cast<Space&>(home).alloc<int>(2*x.size()) : NULL) {
     home.notice(*this,AP_WEAKLY);
   }
 
   template<class View, class Offset>
   forceinline
   Base<View,Offset>::Base(Space& home, Base<View,Offset>& p)
-    : NaryPropagator<View,Int::PC_INT_DOM>(home,p), start(p.start) {
+    : NaryPropagator<View,Int::PC_INT_DOM>(home,p), start(p.start),
+      cr(p.cr), c(NULL) {
     o.update(p.o);
     y.update(home,p.y);
+    if (p.c != NULL) {
+      int n = x.size();
+      c = home.alloc<int>(2*n);
+      for (int i=2*n; i--; )
+        c[i] = p.c[i];
+    }
+  }
+
+  template<class View, class Offset>
+  forceinline bool
+  Base<View,Offset>::certified(void) {
+    if (cr < 0)
+      return false;
+    int n = x.size();
+    for (int i=n; i--; )
+      if ((i != cr) &&
+          (!o(x[c[i]]).in(i) || !o(x[i]).in(c[n+i])))
+        return false;
+    return true;
   }
 
   /// Information required for non-recursive checking for a single scc
@@ -88,6 +110,13 @@ namespace Gecode { namespace Int { namespace Circuit {
       start = v;
     }
 
+    // The graph is still strongly connected
+    if (c != NULL) {
+      if (certified())
+        return ES_FIX;
+      cr = -1;
+    }
+
     /// Information needed for checking scc's
     Region r;
     typedef typename Offset::ViewType OView;
@@ -148,6 +177,8 @@ namespace Gecode { namespace Int { namespace Circuit {
       si[i].v.init(o(x[i]));
       do {
         if (si[si[i].v.val()].pre < 0) {
+          if (c != NULL)
+            c[si[i].v.val()] = i;
           next.push(i);
           i=si[i].v.val();
           goto start;
@@ -162,8 +193,11 @@ namespace Gecode { namespace Int { namespace Circuit {
           n_nq++;
         }
       cont:
-        if (si[si[i].v.val()].low < si[i].min)
+        if (si[si[i].v.val()].low < si[i].min) {
           si[i].min = si[si[i].v.val()].low;
+          if (c != NULL)
+            c[n+i] = si[i].v.val();
+        }
         ++si[i].v;
       } while (si[i].v());
       if (si[i].min < si[i].low) {
@@ -228,6 +262,17 @@ namespace Gecode { namespace Int { namespace Circuit {
           es = ES_NOFIX;
       }
 
+      /*
+       * The tree edges form an out-tree rooted at start. The edges
+       * that first lowered the low-link of a node form an in-tree: along
+       * such an edge either the low-link decreases or it stays the
+       * same and the edge leads to a node finished earlier.
+       *
+       * Pruning might have removed edges of the certificate.
+       */
+      if ((c != NULL) && (es == ES_FIX))
+        cr = start;
+
       // Move start to different node for next run
       start = o(x[start]).min();
 
@@ -43,13 +43,16 @@ namespace Gecode { namespace Int { namespace Circuit {
    */
   template<class View, class Offset>
   forceinline
-  Dom<View,Offset>::Dom(Home home, ViewArray<View>& x, Offset& o)
-    : Base<View,Offset>(home,x,o) {}
+  Dom<View,Offset>::Dom(Home home, ViewArray<View>& x, Offset& o,
+                        bool inc)
+    : Base<View,Offset>(home,x,o,inc) {}
 
   template<class View, class Offset>
   forceinline
   Dom<View,Offset>::Dom(Space& home, Dom<View,Offset>& p)
-    : Base<View,Offset>(home,p) {}
+    : Base<View,Offset>(home,p) {
+    dc.update(home,p.dc);
+  }
 
   template<class View, class Offset>
   Actor*
@@ -115,7 +118,8 @@ namespace Gecode { namespace Int { namespace Circuit {
 
   template<class View, class Offset>
   ExecStatus
-  Dom<View,Offset>::post(Home home, ViewArray<View>& x, Offset& o) {
+  Dom<View,Offset>::post(Home home, ViewArray<View>& x, Offset& o,
+                         bool inc) {
     int n = x.size();
     if (n == 1) {
       GECODE_ME_CHECK(o(x[0]).eq(home,0));
@@ -128,7 +132,7 @@ namespace Gecode { namespace Int { namespace Circuit {
         GECODE_ME_CHECK(o(x[i]).le(home,n));
         GECODE_ME_CHECK(o(x[i]).nq(home,i));
       }
-      (void) new (home) Dom<View,Offset>(home,x,o);
+      (void) new (home) Dom<View,Offset>(home,x,o,inc);
     }
     return ES_OK;
   }
@@ -43,8 +43,9 @@ namespace Gecode { namespace Int { namespace Circuit {
    */
   template<class View, class Offset>
   forceinline
-  Val<View,Offset>::Val(Home home, ViewArray<View>& x, Offset& o)
-    : Base<View,Offset>(home,x,o) {}
+  Val<View,Offset>::Val(Home home, ViewArray<View>& x, Offset& o,
+                        bool inc)
+    : Base<View,Offset>(home,x,o,inc) {}
 
   template<class View, class Offset>
   forceinline
@@ -81,7 +82,8 @@ namespace Gecode { namespace Int { namespace Circuit {
 
   template<class View, class Offset>
   ExecStatus
-  Val<View,Offset>::post(Home home, ViewArray<View>& x, Offset& o) {
+  Val<View,Offset>::post(Home home, ViewArray<View>& x, Offset& o,
+                         bool inc) {
     int n = x.size();
     if (n == 1) {
       GECODE_ME_CHECK(o(x[0]).eq(home,0));
@@ -94,7 +96,7 @@ namespace Gecode { namespace Int { namespace Circuit {
         GECODE_ME_CHECK(o(x[i]).le(home,n));
         GECODE_ME_CHECK(o(x[i]).nq(home,i));
       }
-      (void) new (home) Val<View,Offset>(home,x,o);
+      (void) new (home) Val<View,Offset>(home,x,o,inc);
     }
     return ES_OK;
   }
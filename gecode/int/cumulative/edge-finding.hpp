@@ -49,10 +49,17 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class TaskView, bool inc>
   class StoCap {
   public:
+    /// Type of sort keys
+    typedef unsigned int Key;
     /// Sort order
     bool operator ()(const TaskView& t1, const TaskView& t2) const {
       return inc ? (t1.c() < t2.c()) : (t2.c() < t1.c());
     }
+    /// Return sort key for \a t
+    Key key(const TaskView& t) const {
+      Key k = static_cast<Key>(t.c()) ^ (1U << (sizeof(int)*CHAR_BIT-1));
+      return inc ? k : ~k;
+    }
   };
 
   /// Sort by prec array
@@ -224,6 +224,8 @@ namespace Gecode { namespace Int { namespace Distinct {
   public:
     /// Initialize with non-initialized view-value graph
     DomCtrl(void);
+    /// Keep matching of controller \a dc as hint during cloning
+    void update(Space& home, DomCtrl<View>& dc);
     /// Check whether a view-value graph is available
     bool available(void);
     /// Initialize view-value graph for views \a x
@@ -48,6 +48,12 @@ namespace Gecode { namespace Int { namespace Distinct {
   forceinline
   DomCtrl<View>::DomCtrl(void) {}
 
+  template<class View>
+  forceinline void
+  DomCtrl<View>::update(Space& home, DomCtrl<View>& dc) {
+    g.update(home,dc.g);
+  }
+
   template<class View>
   forceinline bool
   DomCtrl<View>::available(void) {
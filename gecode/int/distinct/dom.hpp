@@ -62,7 +62,9 @@ namespace Gecode { namespace Int { namespace Distinct {
   template<class View>
   forceinline
   Dom<View>::Dom(Space& home, Dom<View>& p)
-    : NaryPropagator<View,PC_INT_DOM>(home,p) {}
+    : NaryPropagator<View,PC_INT_DOM>(home,p) {
+    dc.update(home,p.dc);
+  }
 
   template<class View>
   PropCost
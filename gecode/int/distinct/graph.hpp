@@ -104,9 +104,11 @@ namespace Gecode { namespace Int { namespace Distinct {
     if (n_val < n_view)
       return ES_FAILED;
 
+    // Reuse the matching from the original space, if available
+    match();
     typename ViewValGraph::Graph<View>::ViewNodeStack m(r,n_view);
     for (int i = n_view; i--; )
-      if (!match(m,view[i]))
+      if (!view[i]->matched() && !match(m,view[i]))
         return ES_FAILED;
     return ES_OK;
   }
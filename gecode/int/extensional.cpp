@@ -63,6 +63,36 @@ namespace Gecode {
     GECODE_ES_FAIL(Extensional::post_lgp(home,x,dfa));
   }
 
+  void
+  extensional(Home home, const IntVarArgs& x, const MDD& m,
+              IntPropLevel) {
+    using namespace Int;
+    if (x.size() != m.arity())
+      throw ArgumentSizeMismatch("Int::extensional");
+    if (x.same())
+      throw ArgumentSame("Int::extensional");
+    GECODE_POST;
+    if (m.n_nodes() == 0)
+      home.fail();
+    else
+      GECODE_ES_FAIL(Extensional::post_lgp(home,x,m));
+  }
+
+  void
+  extensional(Home home, const BoolVarArgs& x, const MDD& m,
+              IntPropLevel) {
+    using namespace Int;
+    if (x.size() != m.arity())
+      throw ArgumentSizeMismatch("Int::extensional");
+    if (x.same())
+      throw ArgumentSame("Int::extensional");
+    GECODE_POST;
+    if (m.n_nodes() == 0)
+      home.fail();
+    else
+      GECODE_ES_FAIL(Extensional::post_lgp(home,x,m));
+  }
+
   void
   extensional(Home home, const IntVarArgs& x, const TupleSet& t,
               IntPropLevel) {
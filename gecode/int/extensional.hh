@@ -64,6 +64,14 @@ namespace Gecode { namespace Int { namespace Extensional {
    * The propagator is not capable of dealing with multiple occurences
    * of the same view.
    *
+   * The layered graph is created either from a DFA or from an MDD (where
+   * the states of a layer are the nodes of the corresponding MDD layer).
+   *
+   * The edges of the layered graph never change after posting and are
+   * shared among all clones of the propagator. Each clone only maintains
+   * the positions of the edges that are still alive, the supported
+   * values, and the state degrees.
+   *
    * Requires \code #include <gecode/int/extensional.hh> \endcode
    * \ingroup FuncIntProp
    */
@@ -88,8 +96,36 @@ namespace Gecode { namespace Int { namespace Extensional {
     class Support {
     public:
       Val val; ///< Supported value
-      Degree n_edges; ///< Number of supporting edges
-      Edge* edges; ///< Supporting edges in layered graph
+      Degree n_edges; ///< Number of alive supporting edges
+      Edge* edges; ///< All supporting edges in shared layered graph
+      Degree* alive; ///< Positions of alive supporting edges in \a edges
+    };
+    /// Immutable edges of the layered graph shared among all clones
+    class Edges : public SharedHandle {
+    protected:
+      /// The actual edges
+      class Data : public SharedHandle::Object {
+      public:
+        /// Number of edges
+        unsigned int n;
+        /// The edges
+        Edge* edges;
+        /// Initialize for \a n0 edges
+        Data(unsigned int n0);
+        /// Delete edges
+        virtual ~Data(void);
+      };
+    public:
+      /// Initialize as empty
+      Edges(void);
+      /// Copy constructor
+      Edges(const Edges& e);
+      /// Initialize for \a n edges
+      void init(unsigned int n);
+      /// Return number of edges
+      unsigned int size(void) const;
+      /// Return edges
+      Edge* edges(void) const;
     };
     /// Type for support size
     typedef typename Gecode::Support::IntTypeTraits<Val>::utype ValSize;
@@ -160,18 +196,18 @@ namespace Gecode { namespace Int { namespace Extensional {
     int n;
     /// The layers of the graph
     Layer* layers;
+    /// The shared edges
+    Edges shared;
     /// Maximal number of states per layer
     StateIdx max_states;
     /// Total number of states
     unsigned int n_states;
-    /// Total number of edges
+    /// Total number of alive edges
     unsigned int n_edges;
     /// Index range with in-degree modifications
     IndexRange i_ch;
     /// Index range with out-degree modifications
     IndexRange o_ch;
-    /// Index range for any change (for compression)
-    IndexRange a_ch;
     /// Return in state for layer \a i and state index \a is
     State& i_state(int i, StateIdx is);
     /// Return in state for layer \a i and in state of edge \a e
@@ -184,19 +220,21 @@ namespace Gecode { namespace Int { namespace Extensional {
     State& o_state(int i, const Edge& e);
     /// Decrement in degree for out state of edge \a e for layer \a i
     bool o_dec(int i, const Edge& e);
+    /// Create state information for layer \a i, if not yet available
+    void state_info(Space& home, int i);
     /// Perform consistency check on data structures
     void audit(void);
     /// Initialize layered graph
-    template<class Var>
+    template<class Var, class Graph>
     ExecStatus initialize(Space& home,
-                          const VarArgArray<Var>& x, const DFA& dfa);
+                          const VarArgArray<Var>& x, const Graph& g);
     /// Constructor for cloning \a p
     LayeredGraph(Space& home, LayeredGraph<View,Val,Degree,StateIdx>& p);
   public:
     /// Constructor for posting
-    template<class Var>
+    template<class Var, class Graph>
     LayeredGraph(Home home,
-                 const VarArgArray<Var>& x, const DFA& dfa);
+                 const VarArgArray<Var>& x, const Graph& g);
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home);
     /// Cost function (defined as high linear)
@@ -209,16 +247,16 @@ namespace Gecode { namespace Int { namespace Extensional {
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
-    /// Post propagator on views \a x and DFA \a dfa
-    template<class Var>
+    /// Post propagator on views \a x and graph (DFA or MDD) \a g
+    template<class Var, class Graph>
     static ExecStatus post(Home home,
-                           const VarArgArray<Var>& x, const DFA& dfa);
+                           const VarArgArray<Var>& x, const Graph& g);
   };
 
   /// Select small types for the layered graph propagator
-  template<class Var>
+  template<class Var, class Graph>
   ExecStatus post_lgp(Home home,
-                      const VarArgArray<Var>& x, const DFA& dfa);
+                      const VarArgArray<Var>& x, const Graph& g);
 
 }}}
 
@@ -74,6 +74,173 @@ namespace Gecode { namespace Int { namespace Extensional {
   };
 
 
+  /**
+   * \brief Traits class for graphs
+   *
+   * Each graph from which a layered graph can be created must
+   * specialize this traits class.
+   */
+  template<class Graph>
+  class GraphTraits {};
+
+  /**
+   * \brief Traits class for graphs
+   *
+   * This class specializes the GraphTraits for DFAs, where all layers
+   * have the same transitions.
+   */
+  template<>
+  class GraphTraits<DFA> {
+  public:
+    /// Iterator for transitions of a layer for a value
+    class Transitions : public DFA::Transitions {
+    public:
+      /// Initialize to transitions of DFA \a d for value \a n
+      Transitions(const DFA& d, int i, int n);
+    };
+    /// Iterator for values of a layer
+    class Symbols : public DFA::Symbols {
+    public:
+      /// Initialize to symbols of DFA \a d
+      Symbols(const DFA& d, int i);
+    };
+    /// Return maximal number of states per layer
+    static unsigned int n_states(const DFA& d);
+    /// Return the number of the first final state
+    static int final_fst(const DFA& d);
+    /// Return the number of the last final state
+    static int final_lst(const DFA& d);
+    /// Return smallest value
+    static int min(const DFA& d);
+    /// Return largest value
+    static int max(const DFA& d);
+  };
+
+  /**
+   * \brief Traits class for graphs
+   *
+   * This class specializes the GraphTraits for MDDs, where the only
+   * final state is the terminal node.
+   */
+  template<>
+  class GraphTraits<MDD> {
+  public:
+    /// Iterator for transitions of a layer for a value
+    class Transitions : public MDD::Edges {
+    public:
+      /// Initialize to edges of layer \a i of MDD \a m for value \a n
+      Transitions(const MDD& m, int i, int n);
+      /// Return in-state of current transition
+      int i_state(void) const;
+      /// Return out-state of current transition
+      int o_state(void) const;
+    };
+    /// Iterator for values of a layer
+    class Symbols {
+    private:
+      /// The edges of the layer
+      MDD::Edges e;
+    public:
+      /// Initialize to values of layer \a i of MDD \a m
+      Symbols(const MDD& m, int i);
+      /// Test whether iterator still at a value
+      bool operator ()(void) const;
+      /// Move iterator to next value
+      void operator ++(void);
+      /// Return current value
+      int val(void) const;
+    };
+    /// Return maximal number of states per layer
+    static unsigned int n_states(const MDD& m);
+    /// Return the number of the first final state
+    static int final_fst(const MDD& m);
+    /// Return the number of the last final state
+    static int final_lst(const MDD& m);
+    /// Return smallest value
+    static int min(const MDD& m);
+    /// Return largest value
+    static int max(const MDD& m);
+  };
+
+
+  forceinline
+  GraphTraits<DFA>::Transitions::Transitions(const DFA& d, int, int n)
+    : DFA::Transitions(d,n) {}
+  forceinline
+  GraphTraits<DFA>::Symbols::Symbols(const DFA& d, int)
+    : DFA::Symbols(d) {}
+  forceinline unsigned int
+  GraphTraits<DFA>::n_states(const DFA& d) {
+    return static_cast<unsigned int>(d.n_states());
+  }
+  forceinline int
+  GraphTraits<DFA>::final_fst(const DFA& d) {
+    return d.final_fst();
+  }
+  forceinline int
+  GraphTraits<DFA>::final_lst(const DFA& d) {
+    return d.final_lst();
+  }
+  forceinline int
+  GraphTraits<DFA>::min(const DFA& d) {
+    return d.symbol_min();
+  }
+  forceinline int
+  GraphTraits<DFA>::max(const DFA& d) {
+    return d.symbol_max();
+  }
+
+  forceinline
+  GraphTraits<MDD>::Transitions::Transitions(const MDD& m, int i, int n)
+    : MDD::Edges(m,i,n) {}
+  forceinline int
+  GraphTraits<MDD>::Transitions::i_state(void) const {
+    return i_node();
+  }
+  forceinline int
+  GraphTraits<MDD>::Transitions::o_state(void) const {
+    return o_node();
+  }
+  forceinline
+  GraphTraits<MDD>::Symbols::Symbols(const MDD& m, int i)
+    : e(m,i) {}
+  forceinline bool
+  GraphTraits<MDD>::Symbols::operator ()(void) const {
+    return e();
+  }
+  forceinline void
+  GraphTraits<MDD>::Symbols::operator ++(void) {
+    int v = e.val();
+    do {
+      ++e;
+    } while (e() && (e.val() == v));
+  }
+  forceinline int
+  GraphTraits<MDD>::Symbols::val(void) const {
+    return e.val();
+  }
+  forceinline unsigned int
+  GraphTraits<MDD>::n_states(const MDD& m) {
+    return static_cast<unsigned int>(m.max_width());
+  }
+  forceinline int
+  GraphTraits<MDD>::final_fst(const MDD&) {
+    return 0;
+  }
+  forceinline int
+  GraphTraits<MDD>::final_lst(const MDD&) {
+    return 1;
+  }
+  forceinline int
+  GraphTraits<MDD>::min(const MDD& m) {
+    return m.min();
+  }
+  forceinline int
+  GraphTraits<MDD>::max(const MDD& m) {
+    return m.max();
+  }
+
+
   /*
    * States
    */
@@ -120,6 +287,42 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
 
+  /*
+   * Shared edges
+   */
+  template<class View, class Val, class Degree, class StateIdx>
+  forceinline
+  LayeredGraph<View,Val,Degree,StateIdx>::Edges::Data::Data(unsigned int n0)
+    : n(n0), edges(heap.alloc<Edge>(n0)) {}
+  template<class View, class Val, class Degree, class StateIdx>
+  LayeredGraph<View,Val,Degree,StateIdx>::Edges::Data::~Data(void) {
+    heap.rfree(edges);
+  }
+
+  template<class View, class Val, class Degree, class StateIdx>
+  forceinline
+  LayeredGraph<View,Val,Degree,StateIdx>::Edges::Edges(void) {}
+  template<class View, class Val, class Degree, class StateIdx>
+  forceinline
+  LayeredGraph<View,Val,Degree,StateIdx>::Edges::Edges(const Edges& e)
+    : SharedHandle(e) {}
+  template<class View, class Val, class Degree, class StateIdx>
+  forceinline void
+  LayeredGraph<View,Val,Degree,StateIdx>::Edges::init(unsigned int n) {
+    object(new Data(n));
+  }
+  template<class View, class Val, class Degree, class StateIdx>
+  forceinline unsigned int
+  LayeredGraph<View,Val,Degree,StateIdx>::Edges::size(void) const {
+    return static_cast<Data*>(object())->n;
+  }
+  template<class View, class Val, class Degree, class StateIdx>
+  forceinline typename LayeredGraph<View,Val,Degree,StateIdx>::Edge*
+  LayeredGraph<View,Val,Degree,StateIdx>::Edges::edges(void) const {
+    return static_cast<Data*>(object())->edges;
+  }
+
+
   /*
    * Value iterator
    */
@@ -231,14 +434,15 @@ namespace Gecode { namespace Int { namespace Extensional {
    */
 
   template<class View, class Val, class Degree, class StateIdx>
-  template<class Var>
+  template<class Var, class Graph>
   forceinline
   LayeredGraph<View,Val,Degree,StateIdx>::LayeredGraph(Home home,
                                                        const VarArgArray<Var>& x,
-                                                       const DFA& dfa)
+                                                       const Graph& g)
     : Propagator(home), c(home), n(x.size()),
-      max_states(static_cast<StateIdx>(dfa.n_states())) {
+      max_states(static_cast<StateIdx>(GraphTraits<Graph>::n_states(g))) {
     assert(n > 0);
+    home.notice(*this,AP_DISPOSE);
   }
 
   template<class View, class Val, class Degree, class StateIdx>
@@ -264,11 +468,11 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
   template<class View, class Val, class Degree, class StateIdx>
-  template<class Var>
+  template<class Var, class Graph>
   forceinline ExecStatus
   LayeredGraph<View,Val,Degree,StateIdx>::initialize(Space& home,
                                                      const VarArgArray<Var>& x,
-                                                     const DFA& dfa) {
+                                                     const Graph& g) {
 
     Region r;
 
@@ -283,7 +487,7 @@ namespace Gecode { namespace Int { namespace Extensional {
       layers[i].states = states + i*max_states;
 
     // Allocate temporary memory for edges
-    Edge* edges = r.alloc<Edge>(dfa.max_degree());
+    Edge* edges = r.alloc<Edge>(g.max_degree());
 
     // Mark initial state as being reachable
     i_state(0,0).i_deg = 1;
@@ -296,7 +500,8 @@ namespace Gecode { namespace Int { namespace Extensional {
       // Enter links leaving reachable states (indegree != 0)
       for (ViewValues<View> nx(layers[i].x); nx(); ++nx) {
         Degree n_edges=0;
-        for (DFA::Transitions t(dfa,nx.val()); t(); ++t)
+        for (typename GraphTraits<Graph>::Transitions t(g,i,nx.val());
+             t(); ++t)
           if (i_state(i,static_cast<StateIdx>(t.i_state())).i_deg != 0) {
             i_state(i,static_cast<StateIdx>(t.i_state())).o_deg++;
             o_state(i,static_cast<StateIdx>(t.o_state())).i_deg++;
@@ -304,13 +509,13 @@ namespace Gecode { namespace Int { namespace Extensional {
             edges[n_edges].o_state = static_cast<StateIdx>(t.o_state());
             n_edges++;
           }
-        assert(n_edges <= dfa.max_degree());
+        assert(n_edges <= g.max_degree());
         // Found support for value
         if (n_edges > 0) {
           Support& s = layers[i].support[j];
           s.val = static_cast<Val>(nx.val());
           s.n_edges = n_edges;
-          s.edges = Heap::copy(home.alloc<Edge>(n_edges),edges,n_edges);
+          s.edges = Heap::copy(r.alloc<Edge>(n_edges),edges,n_edges);
           j++;
         }
       }
@@ -319,7 +524,8 @@ namespace Gecode { namespace Int { namespace Extensional {
     }
 
     // Mark final states as reachable
-    for (int s=dfa.final_fst(); s<dfa.final_lst(); s++)
+    for (int s=GraphTraits<Graph>::final_fst(g);
+         s<GraphTraits<Graph>::final_lst(g); s++)
       if (o_state(n-1,static_cast<StateIdx>(s)).i_deg != 0)
         o_state(n-1,static_cast<StateIdx>(s)).o_deg = 1;
 
@@ -428,6 +634,22 @@ namespace Gecode { namespace Int { namespace Extensional {
       max_states = max_s;
     }
 
+    // Move edges to shared edges, all edges are alive
+    {
+      shared.init(n_edges);
+      Edge* e = shared.edges();
+      Degree* a = home.alloc<Degree>(n_edges);
+      for (int i=n; i--; )
+        for (ValSize j=layers[i].size; j--; ) {
+          Support& s = layers[i].support[j];
+          s.edges = Heap::copy(e,s.edges,s.n_edges);
+          s.alive = a;
+          for (Degree d=s.n_edges; d--; )
+            s.alive[d] = d;
+          e += s.n_edges; a += s.n_edges;
+        }
+    }
+
     // Schedule if subsumption is needed
     if (c.empty())
       View::schedule(home,*this,ME_INT_VAL);
@@ -436,30 +658,34 @@ namespace Gecode { namespace Int { namespace Extensional {
     return ES_OK;
   }
 
+  template<class View, class Val, class Degree, class StateIdx>
+  forceinline void
+  LayeredGraph<View,Val,Degree,StateIdx>::state_info(Space& home, int i) {
+    if (layers[i].states != NULL)
+      return;
+    layers[i].states = home.alloc<State>(layers[i].n_states);
+    for (StateIdx j=layers[i].n_states; j--; )
+      layers[i].states[j].init();
+    // Incoming edges
+    if (i > 0)
+      for (ValSize j=layers[i-1].size; j--; ) {
+        Support& s = layers[i-1].support[j];
+        for (Degree deg=s.n_edges; deg--; )
+          o_state(i-1,s.edges[s.alive[deg]]).i_deg++;
+      }
+    // Outgoing edges
+    if (i < n)
+      for (ValSize j=layers[i].size; j--; ) {
+        Support& s = layers[i].support[j];
+        for (Degree deg=s.n_edges; deg--; )
+          i_state(i,s.edges[s.alive[deg]]).o_deg++;
+      }
+  }
+
   template<class View, class Val, class Degree, class StateIdx>
   ExecStatus
   LayeredGraph<View,Val,Degree,StateIdx>::advise(Space& home,
                                                  Advisor& _a, const Delta& d) {
-    // Check whether state information has already been created
-    if (layers[0].states == NULL) {
-      State* states = home.alloc<State>(n_states);
-      for (unsigned int i=n_states; i--; )
-        states[i].init();
-      layers[n].states = states;
-      states += layers[n].n_states;
-      for (int i=n; i--; ) {
-        layers[i].states = states;
-        states += layers[i].n_states;
-        for (ValSize j=layers[i].size; j--; ) {
-          Support& s = layers[i].support[j];
-          for (Degree deg=s.n_edges; deg--; ) {
-            i_state(i,s.edges[deg]).o_deg++;
-            o_state(i,s.edges[deg]).i_deg++;
-          }
-        }
-      }
-    }
-
     Index& a = static_cast<Index&>(_a);
     const int i = a.i;
 
@@ -473,6 +699,8 @@ namespace Gecode { namespace Int { namespace Extensional {
       }
     }
 
+    state_info(home,i); state_info(home,i+1);
+
     bool i_mod = false;
     bool o_mod = false;
 
@@ -485,8 +713,8 @@ namespace Gecode { namespace Int { namespace Extensional {
         // Supported value not any longer in view
         for (Degree deg=s.n_edges; deg--; ) {
           // Adapt states
-          o_mod |= i_dec(i,s.edges[deg]);
-          i_mod |= o_dec(i,s.edges[deg]);
+          o_mod |= i_dec(i,s.edges[s.alive[deg]]);
+          i_mod |= o_dec(i,s.edges[s.alive[deg]]);
         }
       }
       assert(layers[i].support[j].val == n);
@@ -498,8 +726,8 @@ namespace Gecode { namespace Int { namespace Extensional {
         n_edges -= ls.n_edges;
         for (Degree deg=ls.n_edges; deg--; ) {
           // Adapt states
-          o_mod |= i_dec(i,ls.edges[deg]);
-          i_mod |= o_dec(i,ls.edges[deg]);
+          o_mod |= i_dec(i,ls.edges[ls.alive[deg]]);
+          i_mod |= o_dec(i,ls.edges[ls.alive[deg]]);
         }
       }
     } else if (layers[i].x.any(d)) {
@@ -513,8 +741,8 @@ namespace Gecode { namespace Int { namespace Extensional {
           n_edges -= ls.n_edges;
           for (Degree deg=ls.n_edges; deg--; ) {
             // Adapt states
-            o_mod |= i_dec(i,ls.edges[deg]);
-            i_mod |= o_dec(i,ls.edges[deg]);
+            o_mod |= i_dec(i,ls.edges[ls.alive[deg]]);
+            i_mod |= o_dec(i,ls.edges[ls.alive[deg]]);
           }
           ++j;
         } else if (ls.val > static_cast<Val>(rx.max())) {
@@ -532,8 +760,8 @@ namespace Gecode { namespace Int { namespace Extensional {
         n_edges -= ls.n_edges;
         for (Degree deg=ls.n_edges; deg--; ) {
           // Adapt states
-          o_mod |= i_dec(i,ls.edges[deg]);
-          i_mod |= o_dec(i,ls.edges[deg]);
+          o_mod |= i_dec(i,ls.edges[ls.alive[deg]]);
+          i_mod |= o_dec(i,ls.edges[ls.alive[deg]]);
         }
       }
     } else {
@@ -550,8 +778,8 @@ namespace Gecode { namespace Int { namespace Extensional {
         n_edges -= ls.n_edges;
         for (Degree deg=ls.n_edges; deg--; ) {
           // Adapt states
-          o_mod |= i_dec(i,ls.edges[deg]);
-          i_mod |= o_dec(i,ls.edges[deg]);
+          o_mod |= i_dec(i,ls.edges[ls.alive[deg]]);
+          i_mod |= o_dec(i,ls.edges[ls.alive[deg]]);
         }
       }
       // Keep remaining values
@@ -585,7 +813,9 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class View, class Val, class Degree, class StateIdx>
   forceinline size_t
   LayeredGraph<View,Val,Degree,StateIdx>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
     c.dispose(home);
+    shared.~Edges();
     (void) Propagator::dispose(home);
     return sizeof(*this);
   }
@@ -602,6 +832,7 @@ namespace Gecode { namespace Int { namespace Extensional {
                                                     const ModEventDelta&) {
     // Forward pass
     for (int i=i_ch.fst(); i<=i_ch.lst(); i++) {
+      state_info(home,i); state_info(home,i+1);
       bool i_mod = false;
       bool o_mod = false;
       ValSize j=0;
@@ -611,12 +842,12 @@ namespace Gecode { namespace Int { namespace Extensional {
         Support& s=layers[i].support[j];
         n_edges -= s.n_edges;
         for (Degree d=s.n_edges; d--; )
-          if (i_state(i,s.edges[d]).i_deg == 0) {
+          if (i_state(i,s.edges[s.alive[d]]).i_deg == 0) {
             // Adapt states
-            o_mod |= i_dec(i,s.edges[d]);
-            i_mod |= o_dec(i,s.edges[d]);
+            o_mod |= i_dec(i,s.edges[s.alive[d]]);
+            i_mod |= o_dec(i,s.edges[s.alive[d]]);
             // Remove edge
-            s.edges[d] = s.edges[--s.n_edges];
+            s.alive[d] = s.alive[--s.n_edges];
           }
         n_edges += s.n_edges;
         // Check whether value is still supported
@@ -637,6 +868,7 @@ namespace Gecode { namespace Int { namespace Extensional {
 
     // Backward pass
     for (int i=o_ch.lst(); i>=o_ch.fst(); i--) {
+      state_info(home,i); state_info(home,i+1);
       bool o_mod = false;
       ValSize j=0;
       ValSize k=0;
@@ -645,12 +877,12 @@ namespace Gecode { namespace Int { namespace Extensional {
         Support& s=layers[i].support[j];
         n_edges -= s.n_edges;
         for (Degree d=s.n_edges; d--; )
-          if (o_state(i,s.edges[d]).o_deg == 0) {
+          if (o_state(i,s.edges[s.alive[d]]).o_deg == 0) {
             // Adapt states
-            o_mod |= i_dec(i,s.edges[d]);
-            (void)   o_dec(i,s.edges[d]);
+            o_mod |= i_dec(i,s.edges[s.alive[d]]);
+            (void)   o_dec(i,s.edges[s.alive[d]]);
             // Remove edge
-            s.edges[d] = s.edges[--s.n_edges];
+            s.alive[d] = s.alive[--s.n_edges];
           }
         n_edges += s.n_edges;
         // Check whether value is still supported
@@ -667,8 +899,8 @@ namespace Gecode { namespace Int { namespace Extensional {
         o_ch.add(i-1);
     }
 
-    a_ch.add(i_ch); i_ch.reset();
-    a_ch.add(o_ch); o_ch.reset();
+    i_ch.reset();
+    o_ch.reset();
 
     audit();
 
@@ -681,26 +913,27 @@ namespace Gecode { namespace Int { namespace Extensional {
 
 
   template<class View, class Val, class Degree, class StateIdx>
-  template<class Var>
+  template<class Var, class Graph>
   ExecStatus
   LayeredGraph<View,Val,Degree,StateIdx>::post(Home home,
                                                const VarArgArray<Var>& x,
-                                               const DFA& dfa) {
+                                               const Graph& g) {
     if (x.size() == 0) {
       // Check whether the start state 0 is also a final state
-      if ((dfa.final_fst() <= 0) && (dfa.final_lst() >= 0))
+      if ((GraphTraits<Graph>::final_fst(g) <= 0) &&
+          (GraphTraits<Graph>::final_lst(g) >= 0))
         return ES_OK;
       return ES_FAILED;
     }
     assert(x.size() > 0);
     for (int i=x.size(); i--; ) {
-      DFA::Symbols s(dfa);
+      typename GraphTraits<Graph>::Symbols s(g,i);
       typename VarTraits<Var>::View xi(x[i]);
       GECODE_ME_CHECK(xi.inter_v(home,s,false));
     }
     LayeredGraph<View,Val,Degree,StateIdx>* p =
-      new (home) LayeredGraph<View,Val,Degree,StateIdx>(home,x,dfa);
-    return p->initialize(home,x,dfa);
+      new (home) LayeredGraph<View,Val,Degree,StateIdx>(home,x,g);
+    return p->initialize(home,x,g);
   }
 
   template<class View, class Val, class Degree, class StateIdx>
@@ -709,13 +942,14 @@ namespace Gecode { namespace Int { namespace Extensional {
   ::LayeredGraph(Space& home, LayeredGraph<View,Val,Degree,StateIdx>& p)
     : Propagator(home,p),
       n(p.n), layers(home.alloc<Layer>(n+1)),
+      shared(p.shared),
       max_states(p.max_states), n_states(p.n_states), n_edges(p.n_edges) {
     c.update(home,p.c);
-    // Do not allocate states, postpone to advise!
+    // Do not allocate states, postpone until a layer is modified!
     layers[n].n_states = p.layers[n].n_states;
     layers[n].states = NULL;
-    // Allocate memory for edges
-    Edge* edges = home.alloc<Edge>(n_edges);
+    // Allocate memory for alive edges, the edges themselves are shared
+    Degree* alive = home.alloc<Degree>(n_edges);
     // Copy layers
     for (int i=n; i--; ) {
       layers[i].x.update(home,p.layers[i].x);
@@ -726,10 +960,11 @@ namespace Gecode { namespace Int { namespace Extensional {
         layers[i].support[j].val = p.layers[i].support[j].val;
         layers[i].support[j].n_edges = p.layers[i].support[j].n_edges;
         assert(layers[i].support[j].n_edges > 0);
-        layers[i].support[j].edges =
-          Heap::copy(edges,p.layers[i].support[j].edges,
+        layers[i].support[j].edges = p.layers[i].support[j].edges;
+        layers[i].support[j].alive =
+          Heap::copy(alive,p.layers[i].support[j].alive,
                      layers[i].support[j].n_edges);
-        edges += layers[i].support[j].n_edges;
+        alive += layers[i].support[j].n_edges;
       }
       layers[i].n_states = p.layers[i].n_states;
       layers[i].states = NULL;
@@ -756,13 +991,6 @@ namespace Gecode { namespace Int { namespace Extensional {
         k++;
       }
       if (k > 0) {
-        /*
-         * The state information is always available: either the propagator
-         * has been created (hence, also the state information has been
-         * created), or the first variable become assigned and hence
-         * an advisor must have been run (which then has created the state
-         * information).
-         */
         // Eliminate assigned layers
         n -= k; layers += k;
         // Eliminate edges
@@ -770,80 +998,7 @@ namespace Gecode { namespace Int { namespace Extensional {
         // Update advisor indices
         for (Advisors<Index> as(c); as(); ++as)
           as.advisor().i -= k;
-        // Update all change information
-        a_ch.lshift(k);
-      }
-    }
-    audit();
-
-    // Compress states
-    if (!a_ch.empty()) {
-      int f = a_ch.fst();
-      int l = a_ch.lst();
-      assert((f >= 0) && (l <= n));
-      Region r;
-      // State map for in-states
-      StateIdx* i_map = r.alloc<StateIdx>(max_states);
-      // State map for out-states
-      StateIdx* o_map = r.alloc<StateIdx>(max_states);
-      // Number of in-states
-      StateIdx i_n = 0;
-
-      n_states -= layers[l].n_states;
-      // Initialize map for in-states and compress
-      for (StateIdx j=0; j<layers[l].n_states; j++)
-        if ((layers[l].states[j].i_deg != 0) ||
-            (layers[l].states[j].o_deg != 0)) {
-          layers[l].states[i_n]=layers[l].states[j];
-          i_map[j]=i_n++;
-        }
-      layers[l].n_states = i_n;
-      n_states += layers[l].n_states;
-      assert(i_n > 0);
-
-      // Update in-states in edges for last layer, if any
-      if (l < n)
-        for (ValSize j=layers[l].size; j--; ) {
-          Support& s = layers[l].support[j];
-          for (Degree d=s.n_edges; d--; )
-            s.edges[d].i_state = i_map[s.edges[d].i_state];
-        }
-
-      // Update all changed layers
-      for (int i=l-1; i>=f; i--) {
-        // In-states become out-states
-        std::swap(o_map,i_map); i_n=0;
-        // Initialize map for in-states and compress
-        n_states -= layers[i].n_states;
-        for (StateIdx j=0; j<layers[i].n_states; j++)
-          if ((layers[i].states[j].o_deg != 0) ||
-              (layers[i].states[j].i_deg != 0)) {
-            layers[i].states[i_n]=layers[i].states[j];
-            i_map[j]=i_n++;
-          }
-        layers[i].n_states = i_n;
-        n_states += layers[i].n_states;
-        assert(i_n > 0);
-
-        // Update states in edges
-        for (ValSize j=layers[i].size; j--; ) {
-          Support& s = layers[i].support[j];
-          for (Degree d=s.n_edges; d--; ) {
-            s.edges[d].i_state = i_map[s.edges[d].i_state];
-            s.edges[d].o_state = o_map[s.edges[d].o_state];
-          }
-        }
       }
-
-      // Update out-states in edges for previous layer, if any
-      if (f > 0)
-        for (ValSize j=layers[f-1].size; j--; ) {
-          Support& s = layers[f-1].support[j];
-          for (Degree d=s.n_edges; d--; )
-            s.edges[d].o_state = i_map[s.edges[d].o_state];
-        }
-
-      a_ch.reset();
     }
     audit();
 
@@ -851,16 +1006,16 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
   /// Select small types for the layered graph propagator
-  template<class Var>
+  template<class Var, class Graph>
   forceinline ExecStatus
-  post_lgp(Home home, const VarArgArray<Var>& x, const DFA& dfa) {
+  post_lgp(Home home, const VarArgArray<Var>& x, const Graph& g) {
     Gecode::Support::IntType t_state_idx =
-      Gecode::Support::u_type(static_cast<unsigned int>(dfa.n_states()));
+      Gecode::Support::u_type(GraphTraits<Graph>::n_states(g));
     Gecode::Support::IntType t_degree =
-      Gecode::Support::u_type(dfa.max_degree());
+      Gecode::Support::u_type(g.max_degree());
     Gecode::Support::IntType t_val =
-      std::max(Support::s_type(dfa.symbol_min()),
-               Support::s_type(dfa.symbol_max()));
+      std::max(Support::s_type(GraphTraits<Graph>::min(g)),
+               Support::s_type(GraphTraits<Graph>::max(g)));
     switch (t_val) {
     case Gecode::Support::IT_CHAR:
     case Gecode::Support::IT_SHRT:
@@ -870,15 +1025,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned char,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned short int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -887,15 +1042,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned char,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned short int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -904,15 +1059,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned char,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned short int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -926,15 +1081,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned char,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned short int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -943,15 +1098,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned char,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned short int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -960,15 +1115,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned char,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned short int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
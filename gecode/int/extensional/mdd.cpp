@@ -0,0 +1,481 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2018
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int.hh>
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /**
+   * \brief Sort edges by layer, in-node, value, and out-node
+   */
+  class EdgeByLayerI_Node {
+  public:
+    forceinline bool
+    operator ()(const MDD::Edge& x, const MDD::Edge& y) {
+      if (x.layer != y.layer)
+        return x.layer < y.layer;
+      if (x.i_node != y.i_node)
+        return x.i_node < y.i_node;
+      if (x.val != y.val)
+        return x.val < y.val;
+      return x.o_node < y.o_node;
+    }
+    forceinline static void
+    sort(MDD::Edge e[], int n) {
+      EdgeByLayerI_Node ebli;
+      Support::quicksort<MDD::Edge,EdgeByLayerI_Node>(e,n,ebli);
+    }
+  };
+
+  /**
+   * \brief Sort edges by layer, value, in-node, and out-node
+   */
+  class EdgeByLayerVal {
+  public:
+    forceinline bool
+    operator ()(const MDD::Edge& x, const MDD::Edge& y) {
+      if (x.layer != y.layer)
+        return x.layer < y.layer;
+      if (x.val != y.val)
+        return x.val < y.val;
+      if (x.i_node != y.i_node)
+        return x.i_node < y.i_node;
+      return x.o_node < y.o_node;
+    }
+    forceinline static void
+    sort(MDD::Edge e[], int n) {
+      EdgeByLayerVal eblv;
+      Support::quicksort<MDD::Edge,EdgeByLayerVal>(e,n,eblv);
+    }
+  };
+
+  /// Remove duplicates from sorted edges \a e of size \a n, return new size
+  forceinline int
+  unique(MDD::Edge e[], int n) {
+    if (n == 0)
+      return 0;
+    int k = 1;
+    for (int i=1; i<n; i++)
+      if ((e[i].layer != e[k-1].layer) || (e[i].i_node != e[k-1].i_node) ||
+          (e[i].val != e[k-1].val) || (e[i].o_node != e[k-1].o_node))
+        e[k++] = e[i];
+    return k;
+  }
+
+  /// A node in a layer with its outgoing edges
+  class NodeEdges {
+  public:
+    /// The node
+    int node;
+    /// First outgoing edge
+    const MDD::Edge* fst;
+    /// Last outgoing edge
+    const MDD::Edge* lst;
+  };
+
+  /**
+   * \brief Sort nodes lexicographically by their outgoing edges
+   */
+  class NodeEdgesByEdges {
+  public:
+    forceinline bool
+    operator ()(const NodeEdges& x, const NodeEdges& y) {
+      const MDD::Edge* i = x.fst;
+      const MDD::Edge* j = y.fst;
+      while ((i < x.lst) && (j < y.lst)) {
+        if (i->val != j->val)
+          return i->val < j->val;
+        if (i->o_node != j->o_node)
+          return i->o_node < j->o_node;
+        i++; j++;
+      }
+      return (i == x.lst) && (j < y.lst);
+    }
+    /// Test whether \a x and \a y have the same outgoing edges
+    forceinline static bool
+    same(const NodeEdges& x, const NodeEdges& y) {
+      if ((x.lst - x.fst) != (y.lst - y.fst))
+        return false;
+      for (const MDD::Edge *i=x.fst, *j=y.fst; i<x.lst; i++, j++)
+        if ((i->val != j->val) || (i->o_node != j->o_node))
+          return false;
+      return true;
+    }
+    forceinline static void
+    sort(NodeEdges ne[], int n) {
+      NodeEdgesByEdges nebe;
+      Support::quicksort<NodeEdges,NodeEdgesByEdges>(ne,n,nebe);
+    }
+  };
+
+  /**
+   * \brief Sort tuples lexicographically
+   */
+  class TupleByLex {
+  public:
+    /// The arity of the tuples
+    int n;
+    /// Initialize for arity \a n0
+    TupleByLex(int n0) : n(n0) {}
+    forceinline bool
+    operator ()(const TupleSet::Tuple& x, const TupleSet::Tuple& y) {
+      for (int i=0; i<n; i++)
+        if (x[i] != y[i])
+          return x[i] < y[i];
+      return false;
+    }
+  };
+
+  /// Return position of \a id in the sorted array \a a of size \a n
+  forceinline int
+  find(const int* a, int n, int id) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+      int mid = lo + (hi - lo) / 2;
+      if (a[mid] < id)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    assert((lo < n) && (a[lo] == id));
+    return lo;
+  }
+
+}}}
+
+namespace Gecode {
+
+  void
+  MDD::init(int n, Edge* e, int n_e) {
+    using namespace Int;
+    using namespace Extensional;
+
+    if (n == 0) {
+      // The empty tuple is accepted
+      MDDI* m = new MDDI(0,0);
+      m->n_nodes = m->max_width = m->width[0] = 1;
+      m->fst[0] = 0;
+      object(m);
+      return;
+    }
+
+    Region r;
+
+    /*
+     * Number all nodes consecutively: node i of layer l gets a number
+     * in the range f[l] to f[l+1]-1.
+     */
+    int* f = r.alloc<int>(n+2);
+    int* ids = r.alloc<int>(2*n_e+2);
+    int r_node, t_node;
+    {
+      // Collect node numbers per layer (the layer is the second component)
+      Edge* ln = r.alloc<Edge>(2*n_e+2);
+      int k = 0;
+      ln[k++] = Edge(0,0,0,0);
+      ln[k++] = Edge(n,0,0,0);
+      for (int i=0; i<n_e; i++) {
+        ln[k++] = Edge(e[i].layer,e[i].i_node,0,0);
+        ln[k++] = Edge(e[i].layer+1,e[i].o_node,0,0);
+      }
+      EdgeByLayerI_Node::sort(ln,k);
+      k = unique(ln,k);
+      int l = 0;
+      for (int i=0; i<k; i++) {
+        while (l <= ln[i].layer)
+          f[l++] = i;
+        ids[i] = ln[i].i_node;
+      }
+      while (l <= n+1)
+        f[l++] = k;
+      r.free<Edge>(ln,2*n_e+2);
+      r_node = f[0] + find(ids+f[0],f[1]-f[0],0);
+      t_node = f[n] + find(ids+f[n],f[n+1]-f[n],0);
+      for (int i=0; i<n_e; i++) {
+        int li = e[i].layer;
+        e[i].i_node = f[li] + find(ids+f[li],f[li+1]-f[li],e[i].i_node);
+        e[i].o_node = f[li+1] + find(ids+f[li+1],f[li+2]-f[li+1],
+                                     e[i].o_node);
+      }
+    }
+    int n_ids = f[n+1];
+
+    // Keep only edges on a path from the root to the terminal node
+    EdgeByLayerI_Node::sort(e,n_e);
+    n_e = unique(e,n_e);
+    {
+      bool* fwd = r.alloc<bool>(n_ids);
+      bool* bwd = r.alloc<bool>(n_ids);
+      for (int i=n_ids; i--; )
+        fwd[i] = bwd[i] = false;
+      fwd[r_node] = true;
+      for (int i=0; i<n_e; i++)
+        if (fwd[e[i].i_node])
+          fwd[e[i].o_node] = true;
+      bwd[t_node] = true;
+      for (int i=n_e; i--; )
+        if (bwd[e[i].o_node])
+          bwd[e[i].i_node] = true;
+      int k = 0;
+      for (int i=0; i<n_e; i++)
+        if (fwd[e[i].i_node] && bwd[e[i].o_node])
+          e[k++] = e[i];
+      n_e = k;
+    }
+
+    if (n_e == 0) {
+      // No tuple is accepted
+      MDDI* m = new MDDI(n,0);
+      for (int l=0; l<=n; l++) {
+        m->width[l] = 0; m->fst[l] = 0;
+      }
+      object(m);
+      return;
+    }
+
+    /*
+     * Merge isomorphic nodes layer by layer, starting from the last
+     * layer. Edges are renumbered to use the node numbers per layer.
+     */
+    MDDI* m = new MDDI(n,n_e);
+    {
+      // Node number in its layer after merging
+      int* node = r.alloc<int>(n_ids);
+      node[t_node] = 0;
+      m->width[n] = 1;
+      NodeEdges* ne = r.alloc<NodeEdges>(n_e);
+      // Edges of layer l are from e_fst to e_lst-1
+      int e_lst = n_e;
+      for (int l=n; l--; ) {
+        int e_fst = e_lst;
+        while ((e_fst > 0) && (e[e_fst-1].layer == l))
+          e_fst--;
+        for (int i=e_fst; i<e_lst; i++)
+          e[i].o_node = node[e[i].o_node];
+        EdgeByLayerI_Node::sort(e+e_fst,e_lst-e_fst);
+        // Edges might have become equal due to merged out-nodes
+        int e_end = e_fst + unique(e+e_fst,e_lst-e_fst);
+        for (int i=e_end; i<e_lst; i++)
+          e[i] = e[e_end-1];
+        int n_ne = 0;
+        for (int i=e_fst; i<e_end; ) {
+          ne[n_ne].node = e[i].i_node;
+          ne[n_ne].fst = e+i;
+          while ((i < e_end) && (e[i].i_node == ne[n_ne].node))
+            i++;
+          ne[n_ne].lst = e+i;
+          n_ne++;
+        }
+        NodeEdgesByEdges::sort(ne,n_ne);
+        int w = 0;
+        for (int i=0; i<n_ne; i++) {
+          if ((i > 0) && !NodeEdgesByEdges::same(ne[i-1],ne[i]))
+            w++;
+          node[ne[i].node] = w;
+        }
+        m->width[l] = w+1;
+        for (int i=e_fst; i<e_lst; i++)
+          e[i].i_node = node[e[i].i_node];
+        e_lst = e_fst;
+      }
+      assert(m->width[0] == 1);
+    }
+
+    // Remove edges of merged nodes and sort by layer and value
+    EdgeByLayerVal::sort(e,n_e);
+    n_e = unique(e,n_e);
+    m->n_edges = n_e;
+    Heap::copy(m->edges,e,n_e);
+
+    // Compute remaining information
+    {
+      int l = 0;
+      for (int i=0; i<n_e; i++)
+        while (l <= m->edges[i].layer)
+          m->fst[l++] = i;
+      while (l <= n)
+        m->fst[l++] = n_e;
+      // Offsets of node degrees per layer
+      int* d_fst = r.alloc<int>(n+1);
+      int n_nodes = 0;
+      for (int j=0; j<=n; j++) {
+        d_fst[j] = n_nodes;
+        n_nodes += m->width[j];
+        m->max_width = std::max(m->max_width,m->width[j]);
+      }
+      m->n_nodes = n_nodes;
+      unsigned int* i_deg = r.alloc<unsigned int>(n_nodes);
+      unsigned int* o_deg = r.alloc<unsigned int>(n_nodes);
+      for (int i=n_nodes; i--; )
+        i_deg[i] = o_deg[i] = 0U;
+      unsigned int v_deg = 0U;
+      for (int i=0; i<n_e; i++) {
+        const Edge& ei = m->edges[i];
+        o_deg[d_fst[ei.layer]+ei.i_node]++;
+        i_deg[d_fst[ei.layer+1]+ei.o_node]++;
+        m->min = std::min(m->min,ei.val);
+        m->max = std::max(m->max,ei.val);
+        if ((i > 0) && (m->edges[i-1].layer == ei.layer) &&
+            (m->edges[i-1].val == ei.val))
+          v_deg++;
+        else
+          v_deg = 1U;
+        m->max_degree = std::max(m->max_degree,v_deg);
+      }
+      for (int i=n_nodes; i--; )
+        m->max_degree = std::max(m->max_degree,std::max(i_deg[i],o_deg[i]));
+    }
+    object(m);
+  }
+
+  MDD::MDD(int n, const Edge e_spec[]) {
+    using namespace Int;
+    if (n < 0)
+      throw OutOfLimits("MDD::MDD");
+    int n_e = 0;
+    for (const Edge* e = &e_spec[0]; e->layer >= 0; e++) {
+      if ((e->layer >= n) || (e->i_node < 0) || (e->o_node < 0))
+        throw OutOfLimits("MDD::MDD");
+      Limits::check(e->val,"MDD::MDD");
+      n_e++;
+    }
+    Region r;
+    Edge* e = r.alloc<Edge>(n_e);
+    for (int i=n_e; i--; )
+      e[i] = e_spec[i];
+    init(n,e,n_e);
+  }
+
+  MDD::MDD(const TupleSet& ts) {
+    using namespace Int;
+    using namespace Extensional;
+    if (!ts.finalized())
+      throw NotYetFinalized("MDD::MDD");
+    int n = ts.arity();
+    int m = ts.tuples();
+    Region r;
+    // Sort tuples lexicographically
+    TupleSet::Tuple* t = r.alloc<TupleSet::Tuple>(m);
+    for (int i=m; i--; )
+      t[i] = ts[i];
+    TupleByLex tbl(n);
+    Support::quicksort<TupleSet::Tuple,TupleByLex>(t,m,tbl);
+    // Build a trie where tuples with a common prefix share their path
+    Edge* e = r.alloc<Edge>(m*n);
+    int n_e = 0;
+    // Node of the path of the last tuple in each layer
+    int* node = r.alloc<int>(n+1);
+    // Next free node number in each layer
+    int* next = r.alloc<int>(n+1);
+    for (int l=n+1; l--; ) {
+      node[l] = 0; next[l] = 1;
+    }
+    for (int k=0; k<m; k++) {
+      // Length of the prefix shared with the previous tuple
+      int p = 0;
+      if (k > 0)
+        while ((p < n) && (t[k][p] == t[k-1][p]))
+          p++;
+      for (int l=p; l<n; l++) {
+        int o = (l+1 == n) ? 0 : next[l+1]++;
+        e[n_e++] = Edge(l,node[l],t[k][l],o);
+        node[l+1] = o;
+      }
+    }
+    init(n,e,n_e);
+  }
+
+  MDD::MDD(int n, const DFA& d) {
+    using namespace Int;
+    if (n < 0)
+      throw OutOfLimits("MDD::MDD");
+    Region r;
+    int s = d.n_states();
+    // Which states are reachable in the current layer
+    bool* reach = r.alloc<bool>(s);
+    bool* n_reach = r.alloc<bool>(s);
+    // Count the edges of the unrolled automaton
+    int n_e = 0;
+    for (int i=s; i--; )
+      reach[i] = false;
+    reach[0] = true;
+    for (int l=0; l<n; l++) {
+      for (int i=s; i--; )
+        n_reach[i] = false;
+      for (DFA::Transitions t(d); t(); ++t)
+        if (reach[t.i_state()]) {
+          if ((l+1 < n) ||
+              ((d.final_fst() <= t.o_state()) &&
+               (t.o_state() < d.final_lst())))
+            n_e++;
+          n_reach[t.o_state()] = true;
+        }
+      std::swap(reach,n_reach);
+    }
+    if ((n == 0) && !((d.final_fst() <= 0) && (0 < d.final_lst()))) {
+      // The empty word is not accepted
+      MDDI* m = new MDDI(0,0);
+      m->width[0] = 0; m->fst[0] = 0;
+      object(m);
+      return;
+    }
+    // Create the edges: nodes in a layer are the states of the DFA
+    Edge* e = r.alloc<Edge>(n_e);
+    n_e = 0;
+    for (int i=s; i--; )
+      reach[i] = false;
+    reach[0] = true;
+    for (int l=0; l<n; l++) {
+      for (int i=s; i--; )
+        n_reach[i] = false;
+      for (DFA::Transitions t(d); t(); ++t)
+        if (reach[t.i_state()]) {
+          if (l+1 < n)
+            e[n_e++] = Edge(l,t.i_state(),t.symbol(),t.o_state());
+          else if ((d.final_fst() <= t.o_state()) &&
+                   (t.o_state() < d.final_lst()))
+            e[n_e++] = Edge(l,t.i_state(),t.symbol(),0);
+          n_reach[t.o_state()] = true;
+        }
+      std::swap(reach,n_reach);
+    }
+    init(n,e,n_e);
+  }
+
+}
+
+// STATISTICS: int-prop
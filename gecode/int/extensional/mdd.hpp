@@ -0,0 +1,223 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2018
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Data stored for an %MDD
+   *
+   */
+  class MDD::MDDI : public SharedHandle::Object {
+  public:
+    /// Arity
+    int n;
+    /// Number of nodes
+    int n_nodes;
+    /// Number of edges
+    int n_edges;
+    /// Maximal number of nodes per layer
+    int max_width;
+    /// Maximal degree of any node and maximal number of edges per layer and value
+    unsigned int max_degree;
+    /// Smallest value
+    int min;
+    /// Largest value
+    int max;
+    /// Number of nodes per layer
+    int* width;
+    /// Start of edges per layer (edges of layer \a l are from \a fst[l] to \a fst[l+1]-1)
+    int* fst;
+    /// The edges (sorted by layer, value, and in-node)
+    Edge* edges;
+    /// Initialize for arity \a n0 and \a ne edges
+    MDDI(int n0, int ne);
+    /// Delete implementation
+    virtual ~MDDI(void);
+  };
+
+  forceinline
+  MDD::MDDI::MDDI(int n0, int ne)
+    : n(n0), n_nodes(0), n_edges(ne), max_width(0), max_degree(0),
+      min(Int::Limits::max), max(Int::Limits::min),
+      width(heap.alloc<int>(n0+1)), fst(heap.alloc<int>(n0+1)),
+      edges(ne == 0 ? NULL : heap.alloc<Edge>(ne)) {}
+
+  forceinline
+  MDD::MDDI::~MDDI(void) {
+    heap.rfree(width);
+    heap.rfree(fst);
+    if (edges != NULL)
+      heap.rfree(edges);
+  }
+
+
+  forceinline
+  MDD::MDD(void) {}
+
+  forceinline
+  MDD::MDD(const MDD& m)
+    : SharedHandle(m) {}
+
+  forceinline int
+  MDD::arity(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == NULL) ? 0 : m->n;
+  }
+
+  forceinline int
+  MDD::n_nodes(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == NULL) ? 1 : m->n_nodes;
+  }
+
+  forceinline int
+  MDD::n_edges(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == NULL) ? 0 : m->n_edges;
+  }
+
+  forceinline int
+  MDD::width(int l) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == NULL) ? 1 : m->width[l];
+  }
+
+  forceinline int
+  MDD::max_width(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == NULL) ? 1 : m->max_width;
+  }
+
+  forceinline unsigned int
+  MDD::max_degree(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == NULL) ? 0 : m->max_degree;
+  }
+
+  forceinline int
+  MDD::min(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return ((m != NULL) && (m->n_edges > 0)) ? m->min : Int::Limits::min;
+  }
+
+  forceinline int
+  MDD::max(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return ((m != NULL) && (m->n_edges > 0)) ? m->max : Int::Limits::max;
+  }
+
+
+  /*
+   * Constructing edges
+   *
+   */
+
+  forceinline
+  MDD::Edge::Edge(void) {}
+
+  forceinline
+  MDD::Edge::Edge(int layer0, int i_node0, int val0, int o_node0)
+    : layer(layer0), i_node(i_node0), val(val0), o_node(o_node0) {}
+
+
+  /*
+   * Iterating over edges
+   *
+   */
+
+  forceinline
+  MDD::Edges::Edges(const MDD& m, int l) {
+    const MDDI* o = static_cast<MDDI*>(m.object());
+    if (o != NULL) {
+      c_edge = o->edges + o->fst[l];
+      e_edge = o->edges + o->fst[l+1];
+    } else {
+      c_edge = e_edge = NULL;
+    }
+  }
+
+  forceinline
+  MDD::Edges::Edges(const MDD& m, int l, int n) {
+    const MDDI* o = static_cast<MDDI*>(m.object());
+    if (o != NULL) {
+      // Binary search for first edge with value n
+      const Edge* lo = o->edges + o->fst[l];
+      const Edge* hi = o->edges + o->fst[l+1];
+      while (lo < hi) {
+        const Edge* mid = lo + (hi - lo) / 2;
+        if (mid->val < n)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      c_edge = e_edge = lo;
+      hi = o->edges + o->fst[l+1];
+      while ((e_edge < hi) && (e_edge->val == n))
+        e_edge++;
+    } else {
+      c_edge = e_edge = NULL;
+    }
+  }
+
+  forceinline bool
+  MDD::Edges::operator ()(void) const {
+    return c_edge < e_edge;
+  }
+
+  forceinline void
+  MDD::Edges::operator ++(void) {
+    c_edge++;
+  }
+
+  forceinline int
+  MDD::Edges::i_node(void) const {
+    return c_edge->i_node;
+  }
+
+  forceinline int
+  MDD::Edges::val(void) const {
+    return c_edge->val;
+  }
+
+  forceinline int
+  MDD::Edges::o_node(void) const {
+    return c_edge->o_node;
+  }
+
+}
+
+// STATISTICS: int-prop
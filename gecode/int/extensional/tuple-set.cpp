@@ -65,10 +65,14 @@ namespace Gecode { namespace Int { namespace Extensional {
     /// The position of the tuples to compare
     int p;
   public:
+    /// Type of sort keys
+    typedef unsigned int Key;
     /// Initialize with position \a p
     PosCompare(int p);
     /// Comparison of tuples \a a and \a b
     bool operator ()(const Tuple& a, const Tuple& b);
+    /// Return sort key for tuple \a a
+    Key key(const Tuple& a) const;
   };
 
 
@@ -94,9 +98,23 @@ namespace Gecode { namespace Int { namespace Extensional {
     return a[p] < b[p];
   }
 
+  forceinline PosCompare::Key
+  PosCompare::key(const Tuple& a) const {
+    return static_cast<Key>(a[p]) ^ (1U << (sizeof(int)*CHAR_BIT-1));
+  }
 
 }}}
 
+namespace Gecode { namespace Support {
+
+  /// Sorting tuples by position uses keys
+  template<>
+  class SortTraits<Int::Extensional::Tuple,Int::Extensional::PosCompare>
+    : public KeySortTraits<Int::Extensional::Tuple,
+                           Int::Extensional::PosCompare> {};
+
+}}
+
 namespace Gecode {
 
   /*
@@ -233,6 +233,16 @@ namespace Gecode { namespace Int { namespace GCC {
     ViewArray<Card> k;
     /// Propagation is performed on a variable-value graph (used as cache)
     VarValGraph<Card>* vvg;
+    /**
+     * \brief Values matched to the views in \a x in the original space
+     *
+     * The graph is not copied during cloning. Instead, the first
+     * \a x.size() entries store the values matched for the upper bounds
+     * and the remaining entries the values matched for the lower bounds
+     * (NULL if no graph was available). They initialize the matchings
+     * when the graph is rebuilt.
+     */
+    int* mh;
     /**
      * \brief Stores whether cardinalities are all assigned
      *
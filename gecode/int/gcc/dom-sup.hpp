@@ -441,9 +441,15 @@ namespace Gecode { namespace Int { namespace GCC {
     //@}
     /// \name Graph-interface
     //@{
-    /// Check whether minimum requirements shrink variable domains
+    /**
+     * \brief Check whether minimum requirements shrink variable domains
+     *
+     * If \a h is not NULL, the entries \a h[i] and \a h[n+i] are
+     * moved together with the variable \a x[i].
+     */
     ExecStatus min_require(Space& home,
-                           ViewArray<IntView>& x, ViewArray<Card>& k);
+                           ViewArray<IntView>& x, ViewArray<Card>& k,
+                           int* h=NULL, int n=0);
 
     /**
      * \brief Synchronization of the graph
@@ -467,6 +473,22 @@ namespace Gecode { namespace Int { namespace GCC {
      */
     template<BC>
     ExecStatus maximum_matching(void);
+    /**
+     * \brief Compute a maximum matching M on the graph starting from \a h
+     *
+     * The matching is initialized by matching variable \a i to
+     * value \a h[i] whenever possible.
+     */
+    template<BC>
+    ExecStatus maximum_matching(const int* h);
+    /**
+     * \brief Store the values matched to the variables in \a h
+     *
+     * If variable \a i is not matched, \a h[i] is set to
+     * Int::Limits::infinity.
+     */
+    template<BC>
+    void matching(int* h) const;
 
     /// Compute possible free alternating paths in the graph
     template<BC>
@@ -1081,7 +1103,8 @@ namespace Gecode { namespace Int { namespace GCC {
   inline ExecStatus
   VarValGraph<Card>::min_require(Space& home,
                                  ViewArray<IntView>& x,
-                                 ViewArray<Card>& k) {
+                                 ViewArray<Card>& k,
+                                 int* h, int n) {
     for (int i = n_val; i--; ) {
       ValNode* vln = vals[i];
       if (vln->noe > 0) {
@@ -1105,6 +1128,9 @@ namespace Gecode { namespace Int { namespace GCC {
             vars[vi] = vars[--n_var];
             vars[vi]->index(vi);
             x.move_lst(vi);
+            if (h != NULL) {
+              h[vi] = h[n_var]; h[n+vi] = h[n+n_var];
+            }
             n_node--;
             vln->noe--;
           }
@@ -1510,10 +1536,36 @@ namespace Gecode { namespace Int { namespace GCC {
     return ES_OK;
   }
 
+  template<class Card> template<BC bc>
+  forceinline void
+  VarValGraph<Card>::matching(int* h) const {
+    for (int i = n_var; i--; ) {
+      Edge* e = vars[i]->get_match(bc);
+      h[i] = (e != NULL) ? e->getVal()->val : Limits::infinity;
+    }
+  }
+
   template<class Card>  template<BC bc>
   inline ExecStatus
   VarValGraph<Card>::maximum_matching(void) {
+    return maximum_matching<bc>(NULL);
+  }
+
+  template<class Card>  template<BC bc>
+  inline ExecStatus
+  VarValGraph<Card>::maximum_matching(const int* h) {
     int card_match = 0;
+    // reuse a previous matching as far as possible
+    if (h != NULL)
+      for (int i = n_var; i--; )
+        if (h[i] != Limits::infinity)
+          for (Edge* e = vars[i]->first(); e != NULL; e = e->next())
+            if (e->getVal()->val == h[i]) {
+              if (!vars[i]->matched(bc) && !e->getVal()->matched(bc)) {
+                e->match(bc); card_match++;
+              }
+              break;
+            }
     // find an intial matching in O(n*d)
     // greedy algorithm
     for (int i = n_val; i--; )
@@ -71,7 +71,7 @@ namespace Gecode { namespace Int { namespace GCC {
   Dom<Card>::Dom(Home home, ViewArray<IntView>& x0,
                  ViewArray<Card>& k0, bool cf)
     : Propagator(home), x(x0),  y(home, x0),
-      k(k0), vvg(NULL), card_fixed(cf){
+      k(k0), vvg(NULL), mh(NULL), card_fixed(cf){
     // y is used for bounds propagation since prop_bnd needs all variables
     // values within the domain bounds
     x.subscribe(home, *this, PC_INT_DOM);
@@ -81,10 +81,17 @@ namespace Gecode { namespace Int { namespace GCC {
   template<class Card>
   forceinline
   Dom<Card>::Dom(Space& home, Dom<Card>& p)
-    : Propagator(home, p), vvg(NULL), card_fixed(p.card_fixed) {
+    : Propagator(home, p), vvg(NULL), mh(NULL), card_fixed(p.card_fixed) {
     x.update(home, p.x);
     y.update(home, p.y);
     k.update(home, p.k);
+    if (p.vvg != NULL) {
+      // Keep the matchings to speed up rebuilding the graph
+      mh = home.alloc<int>(2*x.size());
+      p.vvg->template matching<UBC>(mh);
+      if (!card_fixed)
+        p.vvg->template matching<LBC>(mh+x.size());
+    }
   }
 
   template<class Card>
@@ -194,11 +201,21 @@ namespace Gecode { namespace Int { namespace GCC {
       if ((x.size() < smin) || (smax < x.size()))
         return ES_FAILED;
 
+      int n = x.size();
       vvg = new (home) VarValGraph<Card>(home, x, k, smin, smax);
-      GECODE_ES_CHECK(vvg->min_require(home,x,k));
-      GECODE_ES_CHECK(vvg->template maximum_matching<UBC>());
-      if (!card_fixed)
-        GECODE_ES_CHECK(vvg->template maximum_matching<LBC>());
+      GECODE_ES_CHECK(vvg->min_require(home,x,k,mh,n));
+      if (mh != NULL) {
+        // Start from the matchings of the original space
+        GECODE_ES_CHECK(vvg->template maximum_matching<UBC>(mh));
+        if (!card_fixed)
+          GECODE_ES_CHECK(vvg->template maximum_matching<LBC>(mh+n));
+        home.free<int>(mh,2*n);
+        mh = NULL;
+      } else {
+        GECODE_ES_CHECK(vvg->template maximum_matching<UBC>());
+        if (!card_fixed)
+          GECODE_ES_CHECK(vvg->template maximum_matching<LBC>());
+      }
     } else {
       GECODE_ES_CHECK(vvg->sync(x,k));
     }
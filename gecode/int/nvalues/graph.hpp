@@ -82,11 +82,13 @@ namespace Gecode { namespace Int { namespace NValues {
       ViewValGraph::Graph<IntView>::init(home,view[i]);
     }
 
+    // Reuse the matching from the original space, if available
+    match();
     // Match the real view nodes, if possible
     Region r;
     ViewNodeStack m(r,n_view);
     for (int i = x.size(); i--; )
-      if (match(m,view[i]))
+      if (view[i]->matched() || match(m,view[i]))
         n_matched++;
   }
 
@@ -99,7 +99,9 @@ namespace Gecode { namespace Int { namespace NValues {
   template<class VY>
   forceinline
   EqInt<VY>::EqInt(Space& home, EqInt<VY>& p)
-    : IntBase<VY>(home, p) {}
+    : IntBase<VY>(home, p) {
+    g.update(home, p.g);
+  }
 
   template<class VY>
   Propagator*
@@ -95,7 +95,9 @@ namespace Gecode { namespace Int { namespace NValues {
   template<class VY>
   forceinline
   GqInt<VY>::GqInt(Space& home, GqInt<VY>& p)
-    : IntBase<VY>(home, p) {}
+    : IntBase<VY>(home, p) {
+    g.update(home, p.g);
+  }
 
   template<class VY>
   Propagator*
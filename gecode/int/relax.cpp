@@ -87,6 +87,56 @@ namespace Gecode {
     Search::relax<BoolVarArgs,Int::Relax>(home,x,sx,r,p,ir);
   }
 
+  void
+  relax(Home home, const IntVarArgs& x, const IntVarArgs& sx,
+        const IntArgs& g, Rnd r, double p) {
+    if ((x.size() != sx.size()) || (x.size() != g.size()))
+      throw Int::ArgumentSizeMismatch("Int::relax");
+    if ((p < 0.0) || (p > 1.0))
+      throw Int::OutOfLimits("Int::relax");
+    for (int i=g.size(); i--; )
+      if (g[i] < 0)
+        throw Int::OutOfLimits("Int::relax");
+    Int::Relax ir;
+    Search::relax<IntVarArgs,Int::Relax>(home,x,sx,g,r,p,ir);
+  }
+
+  void
+  relax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx,
+        const IntArgs& g, Rnd r, double p) {
+    if ((x.size() != sx.size()) || (x.size() != g.size()))
+      throw Int::ArgumentSizeMismatch("Int::relax");
+    if ((p < 0.0) || (p > 1.0))
+      throw Int::OutOfLimits("Int::relax");
+    for (int i=g.size(); i--; )
+      if (g[i] < 0)
+        throw Int::OutOfLimits("Int::relax");
+    Int::Relax ir;
+    Search::relax<BoolVarArgs,Int::Relax>(home,x,sx,g,r,p,ir);
+  }
+
+  void
+  pgrelax(Home home, const IntVarArgs& x, const IntVarArgs& sx,
+          Rnd r, double p) {
+    if (x.size() != sx.size())
+      throw Int::ArgumentSizeMismatch("Int::pgrelax");
+    if ((p < 0.0) || (p > 1.0))
+      throw Int::OutOfLimits("Int::pgrelax");
+    Int::Relax ir;
+    Search::pgrelax<IntVarArgs,Int::Relax>(home,x,sx,r,p,ir);
+  }
+
+  void
+  pgrelax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx,
+          Rnd r, double p) {
+    if (x.size() != sx.size())
+      throw Int::ArgumentSizeMismatch("Int::pgrelax");
+    if ((p < 0.0) || (p > 1.0))
+      throw Int::OutOfLimits("Int::pgrelax");
+    Int::Relax ir;
+    Search::pgrelax<BoolVarArgs,Int::Relax>(home,x,sx,r,p,ir);
+  }
+
 }
 
 // STATISTICS: int-other
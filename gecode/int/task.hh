@@ -533,6 +533,22 @@ namespace Gecode { namespace Int {
 
 }}
 
+namespace Gecode { namespace Support {
+
+  /// Sorting events uses keys
+  template<>
+  class SortTraits<Int::Event,Less<Int::Event> > {
+  public:
+    /// Type of keys
+    typedef unsigned long long int Key;
+    /// Whether the order is defined by keys
+    static const bool keyed = true;
+    /// Return key of event \a e
+    static Key key(Less<Int::Event>& less, const Int::Event& e);
+  };
+
+}}
+
 #include <gecode/int/task/event.hpp>
 
 #endif
@@ -62,6 +62,23 @@ namespace Gecode { namespace Int {
     return time() < e.time();
   }
 
+}}
+
+namespace Gecode { namespace Support {
+
+  forceinline SortTraits<Int::Event,Less<Int::Event> >::Key
+  SortTraits<Int::Event,Less<Int::Event> >::key(Less<Int::Event>&,
+                                                const Int::Event& e) {
+    // Order by time first and then by type
+    const unsigned int s = 1U << (sizeof(int)*CHAR_BIT-1);
+    return (static_cast<Key>(static_cast<unsigned int>(e.time()) ^ s) << 3)
+      | static_cast<Key>(e.type());
+  }
+
+}}
+
+namespace Gecode { namespace Int {
+
 
   template<class Char, class Traits>
   inline std::basic_ostream<Char,Traits>&
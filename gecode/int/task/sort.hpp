@@ -43,32 +43,48 @@ namespace Gecode { namespace Int {
   template<class TaskView, bool inc>
   class StoEst {
   public:
+    /// Type of sort keys
+    typedef unsigned long long int Key;
     /// Sort order
     bool operator ()(const TaskView& t1, const TaskView& t2) const;
+    /// Return sort key for \a t
+    Key key(const TaskView& t) const;
   };
 
   /// Sort by earliest completion times
   template<class TaskView, bool inc>
   class StoEct {
   public:
+    /// Type of sort keys
+    typedef unsigned long long int Key;
     /// Sort order
     bool operator ()(const TaskView& t1, const TaskView& t2) const;
+    /// Return sort key for \a t
+    Key key(const TaskView& t) const;
   };
 
   /// Sort by latest start times
   template<class TaskView, bool inc>
   class StoLst {
   public:
+    /// Type of sort keys
+    typedef unsigned long long int Key;
     /// Sort order
     bool operator ()(const TaskView& t1, const TaskView& t2) const;
+    /// Return sort key for \a t
+    Key key(const TaskView& t) const;
   };
 
   /// Sort by latest completion times
   template<class TaskView, bool inc>
   class StoLct {
   public:
+    /// Type of sort keys
+    typedef unsigned long long int Key;
     /// Sort order
     bool operator ()(const TaskView& t1, const TaskView& t2) const;
+    /// Return sort key for \a t
+    Key key(const TaskView& t) const;
   };
 
   /// Sorting maps rather than tasks
@@ -80,12 +96,65 @@ namespace Gecode { namespace Int {
     /// The sorting order for tasks
     STO<TaskView,inc> sto;
   public:
+    /// Type of sort keys
+    typedef typename STO<TaskView,inc>::Key Key;
     /// Initialize
     SortMap(const TaskViewArray<TaskView>& t);
     /// Sort order
     bool operator ()(int& i, int& j) const;
+    /// Return sort key for \a i
+    Key key(const int& i) const;
   };
 
+  /// Return sort key for primary key \a k1 and secondary key \a k2
+  template<bool inc>
+  unsigned long long int stokey(int k1, int k2);
+
+}}
+
+namespace Gecode { namespace Support {
+
+  /// Sorting tasks by earliest start times uses keys
+  template<class TaskView, bool inc>
+  class SortTraits<TaskView,Int::StoEst<TaskView,inc> >
+    : public KeySortTraits<TaskView,Int::StoEst<TaskView,inc> > {};
+  /// Sorting tasks by earliest completion times uses keys
+  template<class TaskView, bool inc>
+  class SortTraits<TaskView,Int::StoEct<TaskView,inc> >
+    : public KeySortTraits<TaskView,Int::StoEct<TaskView,inc> > {};
+  /// Sorting tasks by latest start times uses keys
+  template<class TaskView, bool inc>
+  class SortTraits<TaskView,Int::StoLst<TaskView,inc> >
+    : public KeySortTraits<TaskView,Int::StoLst<TaskView,inc> > {};
+  /// Sorting tasks by latest completion times uses keys
+  template<class TaskView, bool inc>
+  class SortTraits<TaskView,Int::StoLct<TaskView,inc> >
+    : public KeySortTraits<TaskView,Int::StoLct<TaskView,inc> > {};
+  /// Sorting maps for tasks uses keys
+  template<class TaskView, template<class,bool> class STO, bool inc>
+  class SortTraits<int,Int::SortMap<TaskView,STO,inc> >
+    : public KeySortTraits<int,Int::SortMap<TaskView,STO,inc> > {};
+
+}}
+
+namespace Gecode { namespace Int {
+
+  template<bool inc>
+  forceinline unsigned long long int
+  stokey(int k1, int k2) {
+    const unsigned int s = 1U << (sizeof(int)*CHAR_BIT-1);
+    unsigned long long int k =
+      (static_cast<unsigned long long int>(static_cast<unsigned int>(k1) ^ s)
+       << (sizeof(int)*CHAR_BIT)) | (static_cast<unsigned int>(k2) ^ s);
+    return inc ? k : ~k;
+  }
+
+  template<class TaskView, bool inc>
+  forceinline typename StoEst<TaskView,inc>::Key
+  StoEst<TaskView,inc>::key(const TaskView& t) const {
+    return stokey<inc>(t.est(),t.lct());
+  }
+
   template<class TaskView, bool inc>
   forceinline bool
   StoEst<TaskView,inc>::operator ()
@@ -95,6 +164,12 @@ namespace Gecode { namespace Int {
     : (t2.est() < t1.est() || (t2.est()==t1.est() && t2.lct() < t1.lct()));
   }
 
+  template<class TaskView, bool inc>
+  forceinline typename StoEct<TaskView,inc>::Key
+  StoEct<TaskView,inc>::key(const TaskView& t) const {
+    return stokey<inc>(t.ect(),t.lst());
+  }
+
   template<class TaskView, bool inc>
   forceinline bool
   StoEct<TaskView,inc>::operator ()
@@ -104,6 +179,12 @@ namespace Gecode { namespace Int {
     : (t2.ect() < t1.ect() || (t2.ect()==t1.ect() && t2.lst() < t1.lst()));
   }
 
+  template<class TaskView, bool inc>
+  forceinline typename StoLst<TaskView,inc>::Key
+  StoLst<TaskView,inc>::key(const TaskView& t) const {
+    return stokey<inc>(t.lst(),t.ect());
+  }
+
   template<class TaskView, bool inc>
   forceinline bool
   StoLst<TaskView,inc>::operator ()
@@ -113,6 +194,12 @@ namespace Gecode { namespace Int {
     : (t2.lst() < t1.lst() || (t2.lst()==t1.lst() && t2.ect() < t1.ect()));
   }
 
+  template<class TaskView, bool inc>
+  forceinline typename StoLct<TaskView,inc>::Key
+  StoLct<TaskView,inc>::key(const TaskView& t) const {
+    return stokey<inc>(t.lct(),t.est());
+  }
+
   template<class TaskView, bool inc>
   forceinline bool
   StoLct<TaskView,inc>::operator ()
@@ -131,6 +218,11 @@ namespace Gecode { namespace Int {
   SortMap<TaskView,STO,inc>::operator ()(int& i, int& j) const {
     return sto(tasks[i],tasks[j]);
   }
+  template<class TaskView, template<class,bool> class STO, bool inc>
+  forceinline typename SortMap<TaskView,STO,inc>::Key
+  SortMap<TaskView,STO,inc>::key(const int& i) const {
+    return sto.key(tasks[i]);
+  }
 
   template<class TaskView, SortTaskOrder sto, bool inc>
   forceinline void
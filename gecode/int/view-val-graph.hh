@@ -293,6 +293,24 @@ namespace Gecode { namespace Int { namespace ViewValGraph {
 
 namespace Gecode { namespace Int { namespace ViewValGraph {
 
+  /**
+   * \brief Matching information kept across cloning
+   *
+   * A view-value graph is not copied during cloning. Instead, the
+   * values matched to the views are recorded so that the matching
+   * of a new graph can be initialized from the matching of the graph
+   * of the original space.
+   */
+  class MatchHint {
+  public:
+    /// Variable implementation of the matched view
+    VarImpBase* x;
+    /// Matched value
+    int v;
+    /// Order by variable implementation
+    bool operator <(const MatchHint& h) const;
+  };
+
   /// View-value graph base class
   template<class View>
   class Graph {
@@ -307,10 +325,16 @@ namespace Gecode { namespace Int { namespace ViewValGraph {
     int n_val;
     /// Marking counter
     unsigned int count;
+    /// Number of matching hints
+    int n_hint;
+    /// Matching hints from the graph of the original space
+    MatchHint* hint;
     /// Stack used during matching
     typedef Support::StaticStack<ViewNode<View>*,Region> ViewNodeStack;
     /// Initialize the edges for the view node \a x
     void init(Space& home, ViewNode<View>* x);
+    /// Match view nodes according to the matching hints (if any)
+    void match(void);
     /// Find a matching for node \a x
     bool match(ViewNodeStack& m, ViewNode<View>* x);
     /// Compute the strongly connected components
@@ -320,6 +344,8 @@ namespace Gecode { namespace Int { namespace ViewValGraph {
     Graph(void);
     /// Test whether graph has been initialized
     operator bool(void) const;
+    /// Record the matching of graph \a g as hint during cloning
+    void update(Space& home, Graph<View>& g);
     /// Purge graph if necessary (reset information to avoid overflow)
     void purge(void);
   };
@@ -36,13 +36,21 @@
  */
 
 #include <climits>
+#include <functional>
 
 namespace Gecode { namespace Int { namespace ViewValGraph {
 
+  forceinline bool
+  MatchHint::operator <(const MatchHint& h) const {
+    return std::less<VarImpBase*>()(x,h.x);
+  }
+
+
   template<class View>
   forceinline
   Graph<View>::Graph(void)
-    : view(NULL), val(NULL), n_view(0), n_val(0), count(1U) {}
+    : view(NULL), val(NULL), n_view(0), n_val(0), count(1U),
+      n_hint(0), hint(NULL) {}
 
   template<class View>
   forceinline
@@ -50,6 +58,62 @@ namespace Gecode { namespace Int { namespace ViewValGraph {
     return view != NULL;
   }
 
+  template<class View>
+  forceinline void
+  Graph<View>::update(Space& home, Graph<View>& g) {
+    if (!g)
+      return;
+    hint = home.alloc<MatchHint>(g.n_view);
+    for (int i=0; i<g.n_view; i++) {
+      ViewNode<View>* x = g.view[i];
+      if (!x->fake() && x->matched()) {
+        View y(x->view()), z;
+        z.update(home,y);
+        hint[n_hint].x = z.varimp();
+        hint[n_hint].v = x->edge_fst()->val(x)->val();
+        n_hint++;
+      }
+    }
+  }
+
+  template<class View>
+  forceinline void
+  Graph<View>::match(void) {
+    if (n_hint == 0)
+      return;
+    Support::quicksort<MatchHint>(hint,n_hint);
+    for (int i=n_view; i--; ) {
+      ViewNode<View>* x = view[i];
+      if (x->fake() || x->matched())
+        continue;
+      // Find hint for the view of x by binary search
+      MatchHint h;
+      h.x = x->view().varimp();
+      int l = 0, r = n_hint-1;
+      while (l < r) {
+        int m = l + (r-l) / 2;
+        if (hint[m] < h)
+          l = m+1;
+        else
+          r = m;
+      }
+      if (hint[l].x != h.x)
+        continue;
+      // Use edge to hinted value if the value is still free
+      for (Edge<View>* e = x->val_edges(); e != NULL; e = e->next_edge())
+        if (e->val(x)->val() == hint[l].v) {
+          if (!e->val(x)->matching()) {
+            e->revert(x); e->val(x)->matching(e);
+          }
+          break;
+        } else if (e->val(x)->val() > hint[l].v) {
+          break;
+        }
+    }
+    // Hints are only used once
+    n_hint = 0;
+  }
+
   template<class View>
   forceinline void
   Graph<View>::init(Space& home, ViewNode<View>* x) {
@@ -112,6 +112,16 @@ namespace Gecode {
     const double chb_alpha_decrement = 1e-6;
     /// Initial value for Q-score in CHB
     const double chb_qscore_init = 0.05;
+
+    /// Minimal number of views for which view selection uses a heap
+    const int view_sel_heap = 1024;
+
+    /// Decay factor for measured propagation cost
+    const double cost_decay = 0.9;
+    /// Measured propagation cost (in milliseconds) for cheapest queue
+    const double cost_base = 0.0005;
+    /// Factor by which measured cost increases per queue
+    const double cost_scale = 4.0;
   }}
 
 }
@@ -238,6 +248,7 @@ namespace Gecode {
 #include <gecode/kernel/branch/merit.hpp>
 #include <gecode/kernel/branch/filter.hpp>
 #include <gecode/kernel/branch/view-sel.hpp>
+#include <gecode/kernel/branch/view-sel-heap.hpp>
 #include <gecode/kernel/branch/print.hpp>
 #include <gecode/kernel/branch/view.hpp>
 #include <gecode/kernel/branch/val-sel.hpp>
@@ -70,6 +70,8 @@ namespace Gecode {
     virtual void print(const Space& home, unsigned int a,
                        View x, int i, const Val& n,
                        std::ostream& o) const = 0;
+    /// Notice that all views \a x are assigned in a solution
+    virtual void solved(const Space& home, const ViewArray<View>& x) = 0;
     /// Perform cloning
     virtual ValSelCommitBase<View,Val>* copy(Space& home) = 0;
     /// Whether dispose must always be called (that is, notice is needed)
@@ -120,6 +122,8 @@ namespace Gecode {
     virtual void print(const Space& home, unsigned int a,
                        View x, int i, const Val& n,
                        std::ostream& o) const;
+    /// Notice that all views \a x are assigned in a solution
+    virtual void solved(const Space& home, const ViewArray<View>& x);
     /// Perform cloning
     virtual ValSelCommit<ValSel,ValCommit>* copy(Space& home);
     /// Whether dispose must always be called (that is, notice is needed)
@@ -197,6 +201,13 @@ namespace Gecode {
     c.print(home,a,x,i,n,o);
   }
 
+  template<class ValSel, class ValCommit>
+  void
+  ValSelCommit<ValSel,ValCommit>::solved(const Space& home,
+                                         const ViewArray<View>& x) {
+    s.solved(home,x);
+  }
+
   template<class ValSel, class ValCommit>
   ValSelCommit<ValSel,ValCommit>*
   ValSelCommit<ValSel,ValCommit>::copy(Space& home) {
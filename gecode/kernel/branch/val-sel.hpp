@@ -58,12 +58,54 @@ namespace Gecode {
     ValSel(Space& home, const ValBranch<Var>& vb);
     /// Constructor for cloning
     ValSel(Space& home, ValSel<View,Val>& vs);
+    /// Notice that all views \a x are assigned in a solution
+    void solved(const Space& home, const ViewArray<View>& x);
     /// Whether dispose must always be called (that is, notice is needed)
     bool notice(void) const;
     /// Delete value selection
     void dispose(Space& home);
   };
 
+  /**
+   * \brief Values of views in the last solution
+   *
+   * The values are shared by all copies of a brancher (also among
+   * different threads) so that value selection can prefer the value
+   * a view had in the most recent solution found.
+   */
+  template<class Val>
+  class SolutionValues : public SharedHandle {
+  protected:
+    /// The shared object holding the values
+    class Object : public SharedHandle::Object {
+    public:
+      /// Mutex for accessing the values
+      Support::Mutex m;
+      /// Number of values
+      int n;
+      /// Whether the value at a position is known
+      bool* k;
+      /// The values
+      Val* v;
+      /// Initialize without values
+      Object(void);
+      /// Delete object
+      virtual ~Object(void);
+    };
+  public:
+    /// Initialize with no values known
+    SolutionValues(void);
+    /// Copy constructor
+    SolutionValues(const SolutionValues<Val>& sv);
+    /// Assignment operator
+    SolutionValues<Val>& operator =(const SolutionValues<Val>& sv);
+    /// Remember the values of all assigned views in \a x
+    template<class View>
+    void update(const ViewArray<View>& x);
+    /// Return whether a value for position \a i is known and store it in \a v
+    bool get(int i, Val& v) const;
+  };
+
   /// User-defined value selection
   template<class View>
   class ValSelFunction :
@@ -104,6 +146,9 @@ namespace Gecode {
   forceinline
   ValSel<View,Val>::ValSel(Space&, ValSel<View,Val>&) {}
   template<class View, class Val>
+  forceinline void
+  ValSel<View,Val>::solved(const Space&, const ViewArray<View>&) {}
+  template<class View, class Val>
   forceinline bool
   ValSel<View,Val>::notice(void) const {
     return false;
@@ -113,6 +158,63 @@ namespace Gecode {
   ValSel<View,Val>::dispose(Space&) {}
 
 
+  // Values from last solution
+  template<class Val>
+  forceinline
+  SolutionValues<Val>::Object::Object(void)
+    : n(0), k(NULL), v(NULL) {}
+  template<class Val>
+  SolutionValues<Val>::Object::~Object(void) {
+    heap.free<bool>(k,n);
+    heap.free<Val>(v,n);
+  }
+
+  template<class Val>
+  forceinline
+  SolutionValues<Val>::SolutionValues(void)
+    : SharedHandle(new Object) {}
+  template<class Val>
+  forceinline
+  SolutionValues<Val>::SolutionValues(const SolutionValues<Val>& sv)
+    : SharedHandle(sv) {}
+  template<class Val>
+  forceinline SolutionValues<Val>&
+  SolutionValues<Val>::operator =(const SolutionValues<Val>& sv) {
+    return static_cast<SolutionValues<Val>&>(SharedHandle::operator =(sv));
+  }
+  template<class Val>
+  template<class View>
+  void
+  SolutionValues<Val>::update(const ViewArray<View>& x) {
+    Object* o = static_cast<Object*>(object());
+    o->m.acquire();
+    if (o->n == 0) {
+      o->n = x.size();
+      o->k = heap.alloc<bool>(o->n);
+      o->v = heap.alloc<Val>(o->n);
+      for (int i=0; i<o->n; i++)
+        o->k[i] = false;
+    }
+    assert(o->n == x.size());
+    for (int i=0; i<x.size(); i++)
+      if (x[i].assigned()) {
+        o->k[i] = true; o->v[i] = x[i].val();
+      }
+    o->m.release();
+  }
+  template<class Val>
+  forceinline bool
+  SolutionValues<Val>::get(int i, Val& v) const {
+    Object* o = static_cast<Object*>(object());
+    o->m.acquire();
+    bool k = (i < o->n) && o->k[i];
+    if (k)
+      v = o->v[i];
+    o->m.release();
+    return k;
+  }
+
+
   // User-defined value selection
   template<class View>
   forceinline
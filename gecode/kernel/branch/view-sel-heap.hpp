@@ -0,0 +1,577 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main author:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2018
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Heap of view positions ordered by merit
+   *
+   * The heap is shared between a view selection and a tracker
+   * propagator that records which views have been modified. The
+   * merit of a modified view is only recomputed when the next view
+   * is selected. Ties are broken by position so that the view selected
+   * is the same as for a linear scan.
+   *
+   * \ingroup TaskBranchViewSel
+   */
+  template<class Choose, class Val>
+  class MeritHeap : public LocalObject {
+  protected:
+    /// How to choose
+    Choose c;
+    /// Number of views in the heap
+    int n;
+    /// Heap of view positions
+    int* h;
+    /// Position in heap for each view (-1 if not in heap)
+    int* p;
+    /// Cached merit for each view
+    Val* m;
+    /// Stack of modified views
+    int* d;
+    /// Number of modified views
+    int n_d;
+    /// Whether a view has been modified
+    bool* dm;
+    /// Number of views
+    int size;
+    /// Test whether view \a i is better than view \a j
+    bool better(int i, int j) const;
+    /// Move view at heap position \a k up
+    void up(int k);
+    /// Move view at heap position \a k down
+    void down(int k);
+    /// Remove view \a i from heap
+    void remove(int i);
+  public:
+    /// Constructor for creation for \a s views
+    MeritHeap(Space& home, int s);
+    /// Constructor for cloning \a mh
+    MeritHeap(Space& home, MeritHeap& mh);
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Insert view \a i with merit \a v
+    void insert(int i, Val v);
+    /// Record that view \a i has been modified
+    void modified(int i);
+    /// Return position of best unassigned view in \a x with merit \a mt
+    template<class View, class Merit>
+    int top(Space& home, ViewArray<View>& x, Merit& mt);
+  };
+
+  /**
+   * \brief Handle for merit heaps
+   *
+   * \ingroup TaskBranchViewSel
+   */
+  template<class Choose, class Val>
+  class MeritHeapHandle : public LocalHandle {
+  public:
+    /// Create handle without heap
+    MeritHeapHandle(void);
+    /// Create handle for heap \a mh
+    MeritHeapHandle(MeritHeap<Choose,Val>* mh);
+    /// Copy constructor
+    MeritHeapHandle(const MeritHeapHandle& mhh);
+    /// Assignment operator
+    MeritHeapHandle& operator =(const MeritHeapHandle& mhh);
+    /// Test whether handle refers to a heap
+    bool initialized(void) const;
+    /// Updating during cloning
+    void update(Space& home, MeritHeapHandle& mhh);
+    /// Access to the heap
+    MeritHeap<Choose,Val>* operator ->(void) const;
+  };
+
+  /**
+   * \brief Propagator recording modified views in a merit heap
+   *
+   * The propagator never prunes, it only uses advisors to record
+   * which views have been modified.
+   *
+   * \ingroup TaskBranchViewSel
+   */
+  template<class View, class Choose, class Val>
+  class MeritHeapTracker : public Propagator {
+  protected:
+    /// Advisor for a view at a given position
+    class Idx : public ViewAdvisor<View> {
+    public:
+      /// Position of view
+      int i;
+      /// Constructor for creation
+      Idx(Space& home, Propagator& p, Council<Idx>& c, View x, int i);
+      /// Constructor for cloning \a a
+      Idx(Space& home, Idx& a);
+    };
+    /// The advisors
+    Council<Idx> c;
+    /// Number of advisors left
+    int n;
+    /// The heap
+    MeritHeapHandle<Choose,Val> h;
+    /// Constructor for cloning \a p
+    MeritHeapTracker(Space& home, MeritHeapTracker& p);
+    /// Constructor for posting
+    MeritHeapTracker(Home home, ViewArray<View>& x, int s,
+                     MeritHeapHandle<Choose,Val>& h);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function (record that propagator is cheap)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Propagation function (only invoked for subsumption)
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Record that view has been modified
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post tracker for views \a x from position \a s onwards
+    static void post(Home home, ViewArray<View>& x, int s,
+                     MeritHeapHandle<Choose,Val>& h);
+  };
+
+  /**
+   * \brief Choose view according to merit using a heap
+   *
+   * The heap is only used if the number of views is at least
+   * Kernel::Config::view_sel_heap, otherwise all views are scanned.
+   * The merit must only depend on the domain of a view as the heap
+   * is only updated when a view is modified.
+   *
+   * \ingroup TaskBranchViewSel
+   */
+  template<class Choose, class Merit>
+  class ViewSelChooseHeap : public ViewSelChoose<Choose,Merit> {
+  protected:
+    typedef typename ViewSelChoose<Choose,Merit>::Val Val;
+    typedef typename ViewSelChoose<Choose,Merit>::View View;
+    typedef typename ViewSelChoose<Choose,Merit>::Var Var;
+    using ViewSelChoose<Choose,Merit>::m;
+    /// The heap (only created on first selection)
+    MeritHeapHandle<Choose,Val> h;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for initialization
+    ViewSelChooseHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelChooseHeap(Space& home, ViewSelChooseHeap<Choose,Merit>& vs);
+    //@}
+    /// \name View selection
+    //@{
+    /// Select a view from \a x starting from \a s and return its position
+    virtual int select(Space& home, ViewArray<View>& x, int s);
+    using ViewSelChoose<Choose,Merit>::select;
+    //@}
+  };
+
+  /// Select view with least merit using a heap
+  template<class Merit>
+  class ViewSelMinHeap : public ViewSelChooseHeap<ChooseMin,Merit> {
+    typedef typename ViewSelChooseHeap<ChooseMin,Merit>::View View;
+    typedef typename ViewSelChooseHeap<ChooseMin,Merit>::Var Var;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for initialization
+    ViewSelMinHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelMinHeap(Space& home, ViewSelMinHeap<Merit>& vs);
+    //@}
+    /// \name Resource management and cloning
+    //@{
+    /// Create copy during cloning
+    virtual ViewSel<View>* copy(Space& home);
+    //@}
+  };
+
+  /// Select view with largest merit using a heap
+  template<class Merit>
+  class ViewSelMaxHeap : public ViewSelChooseHeap<ChooseMax,Merit> {
+    typedef typename ViewSelChooseHeap<ChooseMax,Merit>::View View;
+    typedef typename ViewSelChooseHeap<ChooseMax,Merit>::Var Var;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for initialization
+    ViewSelMaxHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelMaxHeap(Space& home, ViewSelMaxHeap<Merit>& vs);
+    //@}
+    /// \name Resource management and cloning
+    //@{
+    /// Create copy during cloning
+    virtual ViewSel<View>* copy(Space& home);
+    //@}
+  };
+
+
+  /*
+   * Merit heap
+   *
+   */
+  template<class Choose, class Val>
+  forceinline
+  MeritHeap<Choose,Val>::MeritHeap(Space& home, int s)
+    : LocalObject(home), n(0),
+      h(home.alloc<int>(s)), p(home.alloc<int>(s)), m(home.alloc<Val>(s)),
+      d(home.alloc<int>(s)), n_d(0), dm(home.alloc<bool>(s)), size(s) {
+    for (int i=0; i<s; i++) {
+      p[i] = -1; dm[i] = false;
+    }
+  }
+
+  template<class Choose, class Val>
+  forceinline
+  MeritHeap<Choose,Val>::MeritHeap(Space& home, MeritHeap& mh)
+    : LocalObject(home,mh), n(mh.n),
+      h(home.alloc<int>(mh.size)), p(home.alloc<int>(mh.size)),
+      m(home.alloc<Val>(mh.size)),
+      d(home.alloc<int>(mh.size)), n_d(mh.n_d),
+      dm(home.alloc<bool>(mh.size)), size(mh.size) {
+    for (int i=0; i<n; i++)
+      h[i] = mh.h[i];
+    for (int i=0; i<n_d; i++)
+      d[i] = mh.d[i];
+    for (int i=0; i<size; i++) {
+      p[i] = mh.p[i]; m[i] = mh.m[i]; dm[i] = mh.dm[i];
+    }
+  }
+
+  template<class Choose, class Val>
+  Actor*
+  MeritHeap<Choose,Val>::copy(Space& home) {
+    return new (home) MeritHeap<Choose,Val>(home,*this);
+  }
+
+  template<class Choose, class Val>
+  forceinline bool
+  MeritHeap<Choose,Val>::better(int i, int j) const {
+    return c(m[i],m[j]) || (!c(m[j],m[i]) && (i < j));
+  }
+
+  template<class Choose, class Val>
+  void
+  MeritHeap<Choose,Val>::up(int k) {
+    int i = h[k];
+    while (k > 0) {
+      int l = (k-1) >> 1;
+      if (!better(i,h[l]))
+        break;
+      h[k] = h[l]; p[h[k]] = k; k = l;
+    }
+    h[k] = i; p[i] = k;
+  }
+
+  template<class Choose, class Val>
+  void
+  MeritHeap<Choose,Val>::down(int k) {
+    int i = h[k];
+    while (true) {
+      int l = 2*k+1;
+      if (l >= n)
+        break;
+      if ((l+1 < n) && better(h[l+1],h[l]))
+        l++;
+      if (!better(h[l],i))
+        break;
+      h[k] = h[l]; p[h[k]] = k; k = l;
+    }
+    h[k] = i; p[i] = k;
+  }
+
+  template<class Choose, class Val>
+  forceinline void
+  MeritHeap<Choose,Val>::remove(int i) {
+    int k = p[i];
+    p[i] = -1;
+    if (k == --n)
+      return;
+    // Move last view into the hole and restore heap order
+    int j = h[n];
+    h[k] = j; p[j] = k;
+    up(k);
+    if (p[j] == k)
+      down(k);
+  }
+
+  template<class Choose, class Val>
+  forceinline void
+  MeritHeap<Choose,Val>::insert(int i, Val v) {
+    assert((i >= 0) && (i < size) && (p[i] < 0));
+    m[i] = v; h[n] = i; p[i] = n; up(n++);
+  }
+
+  template<class Choose, class Val>
+  forceinline void
+  MeritHeap<Choose,Val>::modified(int i) {
+    if (!dm[i]) {
+      dm[i] = true; d[n_d++] = i;
+    }
+  }
+
+  template<class Choose, class Val>
+  template<class View, class Merit>
+  forceinline int
+  MeritHeap<Choose,Val>::top(Space& home, ViewArray<View>& x, Merit& mt) {
+    // Update merits of modified views
+    while (n_d > 0) {
+      int i = d[--n_d];
+      dm[i] = false;
+      if (p[i] < 0)
+        continue;
+      if (x[i].assigned()) {
+        remove(i);
+      } else {
+        Val v = mt(home,x[i],i);
+        if (c(v,m[i])) {
+          m[i] = v; up(p[i]);
+        } else if (c(m[i],v)) {
+          m[i] = v; down(p[i]);
+        }
+      }
+    }
+    assert((n > 0) && !x[h[0]].assigned());
+    return h[0];
+  }
+
+
+  /*
+   * Merit heap handle
+   *
+   */
+  template<class Choose, class Val>
+  forceinline
+  MeritHeapHandle<Choose,Val>::MeritHeapHandle(void) {}
+  template<class Choose, class Val>
+  forceinline
+  MeritHeapHandle<Choose,Val>::MeritHeapHandle(MeritHeap<Choose,Val>* mh)
+    : LocalHandle(mh) {}
+  template<class Choose, class Val>
+  forceinline
+  MeritHeapHandle<Choose,Val>::MeritHeapHandle(const MeritHeapHandle& mhh)
+    : LocalHandle(mhh) {}
+  template<class Choose, class Val>
+  forceinline MeritHeapHandle<Choose,Val>&
+  MeritHeapHandle<Choose,Val>::operator =(const MeritHeapHandle& mhh) {
+    return static_cast<MeritHeapHandle&>(LocalHandle::operator =(mhh));
+  }
+  template<class Choose, class Val>
+  forceinline bool
+  MeritHeapHandle<Choose,Val>::initialized(void) const {
+    return object() != NULL;
+  }
+  template<class Choose, class Val>
+  forceinline void
+  MeritHeapHandle<Choose,Val>::update(Space& home, MeritHeapHandle& mhh) {
+    if (mhh.initialized())
+      LocalHandle::update(home,mhh);
+  }
+  template<class Choose, class Val>
+  forceinline MeritHeap<Choose,Val>*
+  MeritHeapHandle<Choose,Val>::operator ->(void) const {
+    return static_cast<MeritHeap<Choose,Val>*>(object());
+  }
+
+
+  /*
+   * Merit heap tracker
+   *
+   */
+  template<class View, class Choose, class Val>
+  forceinline
+  MeritHeapTracker<View,Choose,Val>::Idx::Idx(Space& home, Propagator& p,
+                                               Council<Idx>& c,
+                                               View x, int i0)
+    : ViewAdvisor<View>(home,p,c,x), i(i0) {}
+  template<class View, class Choose, class Val>
+  forceinline
+  MeritHeapTracker<View,Choose,Val>::Idx::Idx(Space& home, Idx& a)
+    : ViewAdvisor<View>(home,a), i(a.i) {}
+
+  template<class View, class Choose, class Val>
+  forceinline
+  MeritHeapTracker<View,Choose,Val>::
+  MeritHeapTracker(Home home, ViewArray<View>& x, int s,
+                   MeritHeapHandle<Choose,Val>& h0)
+    : Propagator(home), c(home), n(0), h(h0) {
+    for (int i=s; i<x.size(); i++)
+      if (!x[i].assigned()) {
+        (void) new (home) Idx(home,*this,c,x[i],i); n++;
+      }
+  }
+
+  template<class View, class Choose, class Val>
+  forceinline
+  MeritHeapTracker<View,Choose,Val>::
+  MeritHeapTracker(Space& home, MeritHeapTracker& p)
+    : Propagator(home,p), n(p.n) {
+    c.update(home,p.c);
+    h.update(home,p.h);
+  }
+
+  template<class View, class Choose, class Val>
+  Actor*
+  MeritHeapTracker<View,Choose,Val>::copy(Space& home) {
+    return new (home) MeritHeapTracker<View,Choose,Val>(home,*this);
+  }
+
+  template<class View, class Choose, class Val>
+  PropCost
+  MeritHeapTracker<View,Choose,Val>::cost(const Space&,
+                                          const ModEventDelta&) const {
+    return PropCost::record();
+  }
+
+  template<class View, class Choose, class Val>
+  void
+  MeritHeapTracker<View,Choose,Val>::reschedule(Space&) {}
+
+  template<class View, class Choose, class Val>
+  ExecStatus
+  MeritHeapTracker<View,Choose,Val>::propagate(Space& home,
+                                               const ModEventDelta&) {
+    assert(n == 0);
+    return home.ES_SUBSUMED(*this);
+  }
+
+  template<class View, class Choose, class Val>
+  ExecStatus
+  MeritHeapTracker<View,Choose,Val>::advise(Space& home, Advisor& _a,
+                                            const Delta&) {
+    Idx& a = static_cast<Idx&>(_a);
+    h->modified(a.i);
+    if (!a.view().assigned())
+      return ES_FIX;
+    // Only run propagator for subsumption when all views are assigned
+    return (--n == 0) ? home.ES_NOFIX_DISPOSE(c,a) : home.ES_FIX_DISPOSE(c,a);
+  }
+
+  template<class View, class Choose, class Val>
+  size_t
+  MeritHeapTracker<View,Choose,Val>::dispose(Space& home) {
+    c.dispose(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View, class Choose, class Val>
+  void
+  MeritHeapTracker<View,Choose,Val>::post(Home home, ViewArray<View>& x,
+                                          int s,
+                                          MeritHeapHandle<Choose,Val>& h) {
+    (void) new (home) MeritHeapTracker<View,Choose,Val>(home,x,s,h);
+  }
+
+
+  /*
+   * View selection using a merit heap
+   *
+   */
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::
+  ViewSelChooseHeap(Space& home, const VarBranch<Var>& vb)
+    : ViewSelChoose<Choose,Merit>(home,vb) {}
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::
+  ViewSelChooseHeap(Space& home, ViewSelChooseHeap<Choose,Merit>& vs)
+    : ViewSelChoose<Choose,Merit>(home,vs) {
+    h.update(home,vs.h);
+  }
+
+  template<class Choose, class Merit>
+  int
+  ViewSelChooseHeap<Choose,Merit>::select(Space& home, ViewArray<View>& x,
+                                          int s) {
+    if (!h.initialized()) {
+      // Scanning is cheaper for few views
+      if (x.size() - s < Kernel::Config::view_sel_heap)
+        return ViewSelChoose<Choose,Merit>::select(home,x,s);
+      MeritHeap<Choose,Val>* mh =
+        new (home) MeritHeap<Choose,Val>(home,x.size());
+      for (int i=s; i<x.size(); i++)
+        if (!x[i].assigned())
+          mh->insert(i,m(home,x[i],i));
+      h = MeritHeapHandle<Choose,Val>(mh);
+      MeritHeapTracker<View,Choose,Val>::post(home,x,s,h);
+    }
+    return h->top(home,x,m);
+  }
+
+
+  template<class Merit>
+  forceinline
+  ViewSelMinHeap<Merit>::ViewSelMinHeap(Space& home, const VarBranch<Var>& vb)
+    : ViewSelChooseHeap<ChooseMin,Merit>(home,vb) {}
+
+  template<class Merit>
+  forceinline
+  ViewSelMinHeap<Merit>::ViewSelMinHeap(Space& home, ViewSelMinHeap<Merit>& vs)
+    : ViewSelChooseHeap<ChooseMin,Merit>(home,vs) {}
+
+  template<class Merit>
+  ViewSel<typename ViewSelMinHeap<Merit>::View>*
+  ViewSelMinHeap<Merit>::copy(Space& home) {
+    return new (home) ViewSelMinHeap<Merit>(home,*this);
+  }
+
+
+  template<class Merit>
+  forceinline
+  ViewSelMaxHeap<Merit>::ViewSelMaxHeap(Space& home, const VarBranch<Var>& vb)
+    : ViewSelChooseHeap<ChooseMax,Merit>(home,vb) {}
+
+  template<class Merit>
+  forceinline
+  ViewSelMaxHeap<Merit>::ViewSelMaxHeap(Space& home, ViewSelMaxHeap<Merit>& vs)
+    : ViewSelChooseHeap<ChooseMax,Merit>(home,vs) {}
+
+  template<class Merit>
+  ViewSel<typename ViewSelMaxHeap<Merit>::View>*
+  ViewSelMaxHeap<Merit>::copy(Space& home) {
+    return new (home) ViewSelMaxHeap<Merit>(home,*this);
+  }
+
+}
+
+// STATISTICS: kernel-branch
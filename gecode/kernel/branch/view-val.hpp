@@ -130,6 +130,8 @@ namespace Gecode {
      */
     virtual void print(const Space& home, const Choice& c, unsigned int b,
                        std::ostream& o) const;
+    /// Notice that the space \a home is solved
+    virtual void solved(const Space& home) const;
     /// Perform cloning
     virtual Actor* copy(Space& home);
     /// Delete brancher and return its size
@@ -329,6 +331,14 @@ namespace Gecode {
       vsc->print(home,b,xi,pvc.pos().pos,pvc.val(),o);
   }
 
+  template<class View, int n, class Val, unsigned int a,
+           class Filter, class Print>
+  void
+  ViewValBrancher<View,n,Val,a,Filter,Print>
+  ::solved(const Space& home) const {
+    vsc->solved(home,x);
+  }
+
   template<class View, int n, class Val, unsigned int a,
            class Filter, class Print>
   forceinline size_t
@@ -102,6 +102,10 @@ namespace Gecode {
                   std::ostream&) const {
   }
 
+  void
+  Brancher::solved(const Space&) const {
+  }
+
 
   /*
    * Space: Misc
@@ -367,9 +371,11 @@ namespace Gecode {
         }
       d_stable: ;
       } else {
-        // Support disabled propagators and tracing
+        // Support disabled propagators, tracing, and measuring cost
         // Find a non-disabled tracer recorder (possibly null)
         TraceRecorder* tr = findtracerecorder();
+        // Result of propagation
+        ExecStatus es;
 
 #define GECODE_STATUS_TRACE(q,s) \
   if ((tr != NULL) && (tr->events() & TE_PROPAGATE) && \
@@ -389,7 +395,16 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
-        switch (p->propagate(*this,med_o)) {
+        if (pc.p.bid_sc & sc_cost) {
+          Support::Timer t;
+          t.start();
+          es = p->propagate(*this,med_o);
+          if (es != __ES_SUBSUMED)
+            ssd.data().gpi.cost(p->gpi(),t.stop());
+        } else {
+          es = p->propagate(*this,med_o);
+        }
+        switch (es) {
         case ES_FAILED:
           GECODE_STATUS_TRACE(p,FAILED);
           goto failed;
@@ -483,6 +498,9 @@ namespace Gecode {
         b_status = Brancher::cast(b_status->next());
       }
     // No brancher with alternatives left, space is solved
+    for (Brancher* b = Brancher::cast(bl.next());
+         b != Brancher::cast(&bl); b = Brancher::cast(b->next()))
+      b->solved(*this);
     return SS_SOLVED;
 
     // Process failure
@@ -1475,6 +1475,16 @@ namespace Gecode {
     GECODE_KERNEL_EXPORT
     virtual void print(const Space& home, const Choice& c, unsigned int a,
                        std::ostream& o) const;
+    /**
+     * \brief Notice that the space \a home is solved
+     *
+     * This method is called by Space::status for all branchers when
+     * no brancher has alternatives left. It can be used to remember
+     * values from the solution, for example for value selection. By
+     * default, nothing is done.
+     */
+    GECODE_KERNEL_EXPORT
+    virtual void solved(const Space& home) const;
     //@}
     /// \name Id and group support
     //@{
@@ -1597,6 +1607,10 @@ namespace Gecode {
     const Space* l;
     /// No-goods from restart
     const NoGoods& ng;
+    /// Neighbourhood to use for next restart
+    const unsigned int n;
+    /// Relaxation probability for next restart
+    const double p;
     //@}
     /// \name Portfolio-based information
     //@{
@@ -1611,7 +1625,9 @@ namespace Gecode {
              unsigned long int s,
              unsigned long int f,
              const Space* l,
-             NoGoods& ng);
+             NoGoods& ng,
+             unsigned int n=0U,
+             double p=0.0);
     /// Constructor for portfolio-based engine
     MetaInfo(unsigned int a);
     //@}
@@ -1629,6 +1645,16 @@ namespace Gecode {
     const Space* last(void) const;
     /// Return no-goods recorded from restart
     const NoGoods& nogoods(void) const;
+    /**
+     * \brief Return neighbourhood to use for the next restart
+     *
+     * An adaptive large neighbourhood search engine (see ALNS) selects
+     * one of its neighbourhoods for each restart, for other engines
+     * the neighbourhood is always zero.
+     */
+    unsigned int neighbourhood(void) const;
+    /// Return relaxation probability suggested by an ALNS engine (otherwise zero)
+    double relax(void) const;
     //@}
     /// \name Portfolio-based information
     //@{
@@ -1767,13 +1793,15 @@ namespace Gecode {
     static const unsigned reserved_bid = 0U;
 
     /// Number of bits for status control
-    static const unsigned int sc_bits = 2;
+    static const unsigned int sc_bits = 3;
     /// No special features activated
     static const unsigned int sc_fast = 0;
     /// Disabled propagators are supported
     static const unsigned int sc_disabled = 1;
     /// Tracing is supported
     static const unsigned int sc_trace = 2;
+    /// Propagation cost is measured
+    static const unsigned int sc_cost = 4;
 
     union {
       /// Data only available during propagation or branching
@@ -1796,7 +1824,7 @@ namespace Gecode {
         /**
          * \brief Id of next brancher to be created plus status control
          *
-         * The last two bits are reserved for status control.
+         * The last three bits are reserved for status control.
          *
          */
         unsigned int bid_sc;
@@ -1817,6 +1845,8 @@ namespace Gecode {
     } pc;
     /// Put propagator \a p into right queue
     void enqueue(Propagator* p);
+    /// Return queue for cost \a ac of a propagator with measured cost \a t
+    static PropCost::ActualCost measured(PropCost::ActualCost ac, double t);
     /**
      * \name update, and dispose variables
      */
@@ -2616,6 +2646,23 @@ namespace Gecode {
     GECODE_KERNEL_EXPORT void afc_unshare(void);
     //@}
 
+    /// \name Low-level support for measured propagation cost
+    //@{
+    /**
+     * \brief %Set whether propagation cost is measured
+     *
+     * If \a b is true, the execution time of each propagator is measured
+     * and the queue a propagator is scheduled in is determined by its
+     * average measured execution time rather than by the cost returned
+     * by Propagator::cost. Propagators reporting PropCost::record are
+     * not affected. The setting is inherited by clones and the measured
+     * cost is shared among all clones of a space.
+     */
+    void measure_cost(bool b);
+    /// Return whether propagation cost is measured
+    bool measure_cost(void) const;
+    //@}
+
   protected:
     /**
      * \brief Class to iterate over propagators of a space
@@ -3032,12 +3079,16 @@ namespace Gecode {
                      unsigned long int s0,
                      unsigned long int f0,
                      const Space* l0,
-                     NoGoods& ng0)
-    : t(RESTART), r(r0), s(s0), f(f0), l(l0), ng(ng0), a(0) {}
+                     NoGoods& ng0,
+                     unsigned int n0,
+                     double p0)
+    : t(RESTART), r(r0), s(s0), f(f0), l(l0), ng(ng0),
+      n(n0), p(p0), a(0) {}
 
   forceinline
   MetaInfo::MetaInfo(unsigned int a0)
-    : t(PORTFOLIO), r(0), s(0), f(0), l(NULL), ng(NoGoods::eng), a(a0) {}
+    : t(PORTFOLIO), r(0), s(0), f(0), l(NULL), ng(NoGoods::eng),
+      n(0U), p(0.0), a(a0) {}
 
   forceinline MetaInfo::Type
   MetaInfo::type(void) const {
@@ -3069,6 +3120,16 @@ namespace Gecode {
     return ng;
   }
   forceinline unsigned int
+  MetaInfo::neighbourhood(void) const {
+    assert(type() == RESTART);
+    return n;
+  }
+  forceinline double
+  MetaInfo::relax(void) const {
+    assert(type() == RESTART);
+    return p;
+  }
+  forceinline unsigned int
   MetaInfo::asset(void) const {
     assert(type() == PORTFOLIO);
     return a;
@@ -3209,6 +3270,19 @@ namespace Gecode {
     ssd.data().gpi.decay(d);
   }
 
+  forceinline void
+  Space::measure_cost(bool b) {
+    if (b)
+      pc.p.bid_sc |= sc_cost;
+    else
+      pc.p.bid_sc &= ~sc_cost;
+  }
+
+  forceinline bool
+  Space::measure_cost(void) const {
+    return (pc.p.bid_sc & sc_cost) != 0U;
+  }
+
   forceinline size_t
   Actor::dispose(Space&) {
     return sizeof(*this);
@@ -3940,10 +4014,26 @@ namespace Gecode {
    * Space
    *
    */
+  forceinline PropCost::ActualCost
+  Space::measured(PropCost::ActualCost ac, double t) {
+    if ((ac == PropCost::AC_RECORD) || (t < 0.0))
+      return ac;
+    // The more expensive, the lower the queue
+    int q = PropCost::AC_MAX;
+    double c = Kernel::Config::cost_base;
+    while ((q > PropCost::AC_RECORD+1) && (t > c)) {
+      q--; c *= Kernel::Config::cost_scale;
+    }
+    return static_cast<PropCost::ActualCost>(q);
+  }
+
   forceinline void
   Space::enqueue(Propagator* p) {
     ActorLink::cast(p)->unlink();
-    ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
+    PropCost::ActualCost ac = p->cost(*this,p->u.med).ac;
+    if (pc.p.bid_sc & sc_cost)
+      ac = measured(ac,p->gpi().cost);
+    ActorLink* c = &pc.p.queue[ac];
     c->tail(ActorLink::cast(p));
     if (c > pc.p.active)
       pc.p.active = c;
@@ -51,6 +51,8 @@ namespace Gecode { namespace Kernel {
       unsigned int gid;
       /// The afc value
       double afc;
+      /// Measured propagation cost (negative if not yet measured)
+      double cost;
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
     };
@@ -92,6 +94,8 @@ namespace Gecode { namespace Kernel {
     double decay(void) const;
     /// Increment failure count
     void fail(Info& c);
+    /// Record propagation cost \a t (in milliseconds)
+    void cost(Info& c, double t);
     /// Allocate info for existing propagator with pid \a p
     Info* allocate(unsigned int p, unsigned int gid);
     /// Allocate new actor info
@@ -105,7 +109,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Info::init(unsigned int pid0, unsigned int gid0) {
-    pid=pid0; gid=gid0; afc=1.0;
+    pid=pid0; gid=gid0; afc=1.0; cost=-1.0;
   }
 
 
@@ -134,6 +138,20 @@ namespace Gecode { namespace Kernel {
     m.release();
   }
 
+  forceinline void
+  GPI::cost(Info& c, double t) {
+    /*
+     * The update is not synchronized: the measured cost is only used
+     * as a heuristic for scheduling and locking for each propagator
+     * execution would be too expensive.
+     */
+    if (c.cost < 0.0)
+      c.cost = t;
+    else
+      c.cost = Kernel::Config::cost_decay * c.cost +
+        (1.0 - Kernel::Config::cost_decay) * t;
+  }
+
   forceinline double
   GPI::decay(void) const {
     double d;
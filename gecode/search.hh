@@ -118,6 +118,8 @@ namespace Gecode { namespace Search {
 
     /// Minimal number of open nodes for stealing
     const unsigned int steal_limit = 3;
+    /// Whether stealing hands over copies instead of cloning them
+    const bool handover = false;
     /// Initial delay in milliseconds for all but first worker thread
     const unsigned int initial_delay = 5;
 
@@ -129,9 +131,21 @@ namespace Gecode { namespace Search {
     /// Size of a slice in a portfolio and scale factor for restarts(in number of failures)
     const unsigned int slice = 250;
 
+    /// Initial relaxation probability for ALNS
+    const double alns_relax = 0.3;
+    /// Factor by which ALNS adapts the relaxation probability
+    const double alns_adapt = 1.1;
+    /// Decay factor for neighbourhood weights in ALNS
+    const double alns_decay = 0.8;
+    /// Minimal weight of a neighbourhood in ALNS
+    const double alns_weight = 0.05;
+
     /// Depth limit for no-good generation during search
     const unsigned int nogoods_limit = 128;
 
+    /// Progress interval (in milliseconds) for asynchronous search
+    const unsigned int progress = 100U;
+
     /// Default port for CPProfiler
     const unsigned int cpprofiler_port = 6565U;
   }
@@ -755,6 +769,16 @@ namespace Gecode { namespace Search {
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
       unsigned int a_d;
+      /**
+       * \brief Whether stealing hands over copies instead of cloning them
+       *
+       * When a worker steals work in parallel search, the copy on the
+       * victim's path is handed over to the thief rather than being
+       * cloned, provided the victim has another copy to recompute
+       * from. This avoids cloning large spaces while the victim is
+       * blocked at the price of possibly longer recomputation.
+       */
+      bool handover;
       /// Discrepancy limit (for LDS)
       unsigned int d_l;
       /// Number of assets (engines) in a portfolio
@@ -763,6 +787,16 @@ namespace Gecode { namespace Search {
       unsigned int slice;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /**
+       * \brief Activity of no-goods before they are deleted
+       *
+       * Each no-good propagator posted after a restart starts with
+       * this activity. The activity is decremented whenever the
+       * propagator runs without pruning and is reset whenever it
+       * prunes. A propagator whose activity drops to zero deletes
+       * itself. The value zero keeps all no-goods.
+       */
+      unsigned int nogoods_activity;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
@@ -889,6 +923,31 @@ namespace Gecode { namespace Search {
     virtual bool stop(const Statistics& s, const Options& o);
   };
 
+  /**
+   * \brief %Stop-object serving as cancellation token
+   *
+   * Search is stopped as soon as cancel() has been called, possibly
+   * from a different thread than the one performing search. The
+   * token is checked at the same points as any other stop object.
+   * \ingroup TaskModelSearchStop
+   */
+  class GECODE_SEARCH_EXPORT CancelStop : public Stop {
+  protected:
+    /// Whether search has been cancelled
+    std::atomic<bool> c;
+    /// Stop object that is checked as well (can be NULL)
+    Stop* so;
+  public:
+    /// Initialize, also stop if \a so (if not NULL) requests to stop
+    CancelStop(Stop* so=NULL);
+    /// Cancel search
+    void cancel(void);
+    /// Test whether search has been cancelled
+    bool cancelled(void) const;
+    /// Return true if search has been cancelled or \a so requests to stop
+    virtual bool stop(const Statistics& s, const Options& o);
+  };
+
 }}
 
 #include <gecode/search/stop.hpp>
@@ -1190,6 +1249,54 @@ namespace Gecode {
 
 #include <gecode/search/rbs.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Meta-engine performing adaptive large neighbourhood search
+   *
+   * The engine performs restart-based search (see RBS) with the Cutoff
+   * sequence supplied in the options \a o. In addition, for each restart
+   * it selects one of \a n neighbourhoods and a relaxation probability
+   * that are passed to the slave function of \a T via
+   * MetaInfo::neighbourhood() and MetaInfo::relax(). The slave function
+   * is expected to relax the last solution accordingly (see for example
+   * the relax() functions) and to return false.
+   *
+   * Neighbourhoods are selected randomly with probability proportional
+   * to their weight. The weight of a neighbourhood decays towards one if
+   * a restart using it finds a solution and towards zero otherwise. The
+   * relaxation probability is increased if a restart explores its
+   * neighbourhood completely without finding a solution, and decreased
+   * if it hits the cutoff without finding a solution.
+   *
+   * Throws an exception of type Search::UninitializedCutoff if the
+   * cutoff in \a o is not set, and of type Search::ZeroNeighbourhoods
+   * if \a n is zero.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E = BAB>
+  class ALNS : public Search::Base<T> {
+    using Search::Base<T>::e;
+  public:
+    /// Initialize engine for space \a s, \a n neighbourhoods, and options \a o
+    ALNS(T* s, unsigned int n, const Search::Options& o);
+    /// Whether engine does best solution search
+    static const bool best = E<T>::best;
+  };
+
+  /**
+   * \brief Perform adaptive large neighbourhood search
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E>
+  T* alns(T* s, unsigned int n, const Search::Options& o);
+
+}
+
+#include <gecode/search/alns.hpp>
+
 namespace Gecode { namespace Search { namespace Meta {
 
   /// Build a sequential engine
@@ -1287,6 +1394,241 @@ namespace Gecode {
 
 #include <gecode/search/pbs.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Meta-engine performing AND/OR search over independent components
+   *
+   * The engine solves \a n variable-disjoint components of a problem
+   * independently and combines their solutions. This avoids exploring
+   * the cross-product of the components' search trees, where a failure
+   * in one component re-explores the choices made in all others.
+   *
+   * The class \a T must implement member functions
+   * \code void component(unsigned int i) \endcode
+   * and
+   * \code void combine(unsigned int i, const T& s) \endcode
+   *
+   * The function component(i) is executed on a clone of \a s before
+   * searching for the solutions of component \a i with engine \a E. It
+   * must post branchers for the variables of the component only, hence
+   * \a s itself should not contain branchers for these variables. The
+   * function combine(i,s) must constrain the variables of component
+   * \a i to their values in the solution \a s for that component. A
+   * solution is obtained by combining a solution for each component on
+   * a clone of \a s followed by depth-first search.
+   *
+   * If \a E performs best solution search, the engine returns a single
+   * solution that combines the best solutions of all components. This
+   * is optimal for objectives that are the sum of the components'
+   * objectives, provided that after component(i) the cost function of
+   * \a T returns the objective of component \a i. Otherwise, the engine
+   * enumerates all combinations of the components' solutions.
+   *
+   * The engines for the components use the options \a o, in particular
+   * they are parallel engines if \a o requests several threads.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E = DFS>
+  class AndOr : public Search::Base<T> {
+    using Search::Base<T>::e;
+  public:
+    /// Initialize engine for space \a s with \a n components and options \a o
+    AndOr(T* s, unsigned int n,
+          const Search::Options& o=Search::Options::def);
+    /// Whether engine does best solution search
+    static const bool best = E<T>::best;
+  };
+
+  /**
+   * \brief Perform AND/OR search over \a n independent components
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E>
+  T* andor(T* s, unsigned int n,
+           const Search::Options& o=Search::Options::def);
+
+}
+
+#include <gecode/search/andor.hpp>
+
+namespace Gecode {
+
+  /**
+   * \brief Incremental re-solving from a cached root space
+   *
+   * The root space is propagated once and kept. Each request obtains
+   * a clone of the root space by clone(), posts its changes (for
+   * example, additional constraints, fixed assignments, or a bound on
+   * the objective), and searches with solve(). As the clone is already
+   * propagated, only the changes need to be propagated.
+   *
+   * Constraints that requests might not need should be posted in a
+   * propagator group that is disabled before the root space is
+   * propagated. A request then enables the group on its clone (see
+   * PropagatorGroup::enable) rather than rebuilding the model without
+   * the constraints.
+   *
+   * If the branchers of \a T use solution-guided value selection, the
+   * solutions found by a request serve as hints for the next request,
+   * as all clones share the recorded solution values.
+   *
+   * If \a E performs best solution search, solve() returns the best
+   * solution, otherwise the first solution.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E = DFS>
+  class Incremental {
+  protected:
+    /// The propagated root space (NULL if failed)
+    T* r;
+    /// Search options
+    Search::Options opt;
+    /// Statistics of the last search
+    Search::Statistics stat;
+  public:
+    /// Initialize with root space \a s and options \a o
+    Incremental(T* s, const Search::Options& o=Search::Options::def);
+    /// Test whether the root space is failed
+    bool failed(void) const;
+    /// Return a clone of the root space for posting changes (NULL if failed)
+    T* clone(void) const;
+    /// Replace the root space by \a s (for permanent changes)
+    void update(T* s);
+    /// Search for a solution of \a s (typically obtained from clone())
+    T* solve(T* s);
+    /// Search for a solution of the root space
+    T* solve(void);
+    /// Return statistics of the last search
+    Search::Statistics statistics(void) const;
+    /// Delete root space
+    ~Incremental(void);
+  private:
+    /// Disallow copy constructor
+    Incremental(const Incremental&);
+    /// Disallow assigment operator
+    Incremental& operator =(const Incremental&);
+  };
+
+}
+
+#include <gecode/search/incremental.hpp>
+
+#ifdef GECODE_HAS_THREADS
+
+namespace Gecode {
+
+  /**
+   * \brief Asynchronous search with callbacks
+   *
+   * The search with engine \a E is performed by a separate thread and
+   * the constructor returns immediately. Each solution found is passed
+   * to the solution callback which takes ownership of it. While
+   * searching, the progress callback (if any) is called with the
+   * current statistics at most every \a ms milliseconds. When search
+   * terminates, the done callback (if any) is called with the final
+   * statistics and whether search has been stopped (by cancel() or by
+   * the stop object in the options) rather than being complete.
+   *
+   * All callbacks are executed by the search thread. For parallel
+   * engines, the statistics passed to the progress callback are the
+   * ones of the worker that checks for stopping.
+   *
+   * If the options request cloning (the default), \a s is propagated
+   * and cloned by the calling thread before search starts. Otherwise,
+   * the engine takes ownership of \a s and performs all work in the
+   * search thread.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E = DFS>
+  class Async : public Support::Terminator {
+  public:
+    /// Callback for a solution
+    typedef std::function<void(T* s)> Solution;
+    /// Callback for progress
+    typedef std::function<void(const Search::Statistics& s)> Progress;
+    /// Callback for termination
+    typedef std::function<void(const Search::Statistics& s,
+                               bool stopped)> Done;
+  protected:
+    /// Stop object that also reports progress
+    class Monitor : public Search::CancelStop {
+    protected:
+      /// Progress callback
+      Progress f_prog;
+      /// Interval between progress reports
+      unsigned int ms;
+      /// Timer since last progress report
+      Support::Timer t;
+      /// Mutex for reporting progress
+      Support::Mutex m;
+    public:
+      /// Initialize
+      Monitor(Search::Stop* so, Progress f_prog, unsigned int ms);
+      /// Report progress and test whether to stop
+      virtual bool stop(const Search::Statistics& s,
+                        const Search::Options& o);
+    };
+    /// The search running in a separate thread (deleted by the thread)
+    class Job : public Support::Runnable {
+    protected:
+      /// The space to search (NULL if failed)
+      T* s;
+      /// Search options
+      Search::Options opt;
+      /// Solution callback
+      Solution f_sol;
+      /// Termination callback
+      Done f_done;
+      /// The asynchronous search to notify after termination
+      Async* a;
+    public:
+      /// Initialize
+      Job(T* s, const Search::Options& o,
+          Solution f_sol, Done f_done, Async* a);
+      /// Return termination object
+      virtual Support::Terminator* terminator(void) const;
+      /// Perform search
+      virtual void run(void);
+    };
+    /// Cancellation token and progress reporting
+    Monitor monitor;
+    /// Event signalled when the search thread has terminated
+    Support::Event e;
+    /// Whether termination has been waited for
+    bool w;
+  public:
+    /// Start search for space \a s with options \a o
+    Async(T* s, const Search::Options& o, Solution f_sol,
+          Done f_done=nullptr, Progress f_prog=nullptr,
+          unsigned int ms=Search::Config::progress);
+    /// Cancel search (returns immediately)
+    void cancel(void);
+    /// Test whether search has been cancelled
+    bool cancelled(void) const;
+    /// Wait until search terminates (must be called by a single thread)
+    void wait(void);
+    /// Signal termination of the search thread
+    virtual void terminated(void);
+    /// Cancel search and wait for its termination
+    virtual ~Async(void);
+  private:
+    /// Disallow copy constructor
+    Async(const Async&);
+    /// Disallow assigment operator
+    Async& operator =(const Async&);
+  };
+
+}
+
+#include <gecode/search/async.hpp>
+
+#endif
+
 #endif
 
 // STATISTICS: search-other
@@ -0,0 +1,91 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2018
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/support.hh>
+#include <gecode/search/seq/dead.hh>
+
+namespace Gecode { namespace Search { namespace Seq {
+
+  /// Create adaptive large neighbourhood search engine
+  GECODE_SEARCH_EXPORT Engine*
+  alnsengine(Space* master, Stop* stop, Engine* slave,
+             const Search::Statistics& stat, const Options& opt,
+             bool best, unsigned int n);
+
+}}}
+
+namespace Gecode {
+
+  template<class T, template<class> class E>
+  inline
+  ALNS<T,E>::ALNS(T* s, unsigned int n, const Search::Options& m_opt) {
+    if (m_opt.cutoff == NULL)
+      throw Search::UninitializedCutoff("ALNS::ALNS");
+    if (n == 0U)
+      throw Search::ZeroNeighbourhoods("ALNS::ALNS");
+    Search::Options e_opt(m_opt.expand());
+    Search::Statistics stat;
+    e_opt.clone = false;
+    e_opt.stop  = Search::Seq::rbsstop(m_opt.stop);
+    Search::WrapTraceRecorder::engine(e_opt.tracer,
+                                      SearchTracer::EngineType::RBS, 1U);
+    if (s->status(stat) == SS_FAILED) {
+      stat.fail++;
+      if (!m_opt.clone)
+        delete s;
+      e = Search::Seq::dead(e_opt, stat);
+    } else {
+      Space* master = m_opt.clone ? s->clone() : s;
+      Space* slave  = master->clone();
+      MetaInfo mi(0,0,0,NULL,NoGoods::eng,0U,Search::Config::alns_relax);
+      slave->slave(mi);
+      e = Search::Seq::alnsengine(master,e_opt.stop,
+                                  Search::build<T,E>(slave,e_opt),
+                                  stat,m_opt,E<T>::best,n);
+    }
+  }
+
+  template<class T, template<class> class E>
+  inline T*
+  alns(T* s, unsigned int n, const Search::Options& o) {
+    ALNS<T,E> a(s,n,o);
+    return a.next();
+  }
+
+}
+
+// STATISTICS: search-seq
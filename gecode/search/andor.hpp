@@ -0,0 +1,256 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2018
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Search {
+
+  /// AND/OR search engine over independent components
+  template<class T, template<class> class E>
+  class AndOrEngine : public Engine {
+  protected:
+    /// Solutions found for a component
+    typedef Support::DynamicStack<Space*,Heap> Solutions;
+    /// Options for searching combinations
+    Options opt;
+    /// Statistics for the root and all combinations
+    Statistics stat;
+    /// The root space (NULL if failed)
+    T* root;
+    /// Number of components
+    unsigned int n;
+    /// Engines for the components
+    Engine** e;
+    /// Whether the engine for a component is exhausted
+    bool* x;
+    /// Solutions found for the components
+    Solutions* s;
+    /// Current combination of solutions
+    int* cur;
+    /// Component currently being advanced
+    unsigned int a;
+    /// Whether the first combination is still to be found
+    bool first;
+    /// Whether all combinations have been found
+    bool done;
+    /// Return \a j-th solution of component \a i (NULL if none)
+    Space* get(unsigned int i, int j);
+    /// Advance to next combination, return false if none or stopped
+    bool advance(void);
+    /// Return solution for current combination (NULL if none)
+    Space* combine(void);
+  public:
+    /// Initialize for space \a s with \a n components and options \a o
+    AndOrEngine(T* s, unsigned int n, const Options& o);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~AndOrEngine(void);
+  };
+
+  template<class T, template<class> class E>
+  AndOrEngine<T,E>::AndOrEngine(T* s0, unsigned int n0, const Options& o)
+    : opt(o.expand()), root(NULL), n(n0),
+      e(heap.alloc<Engine*>(n0)), x(heap.alloc<bool>(n0)),
+      s(static_cast<Solutions*>(heap.ralloc(n0*sizeof(Solutions)))),
+      cur(heap.alloc<int>(n0)),
+      a(0U), first(true), done(false) {
+    for (unsigned int i=0U; i<n; i++) {
+      e[i] = NULL; x[i] = false; cur[i] = 0;
+      ::new (&s[i]) Solutions(heap);
+    }
+    if (s0->status(stat) == SS_FAILED) {
+      stat.fail++;
+      if (!o.clone)
+        delete s0;
+      done = true;
+      return;
+    }
+    root = o.clone ? static_cast<T*>(s0->clone()) : s0;
+    opt.clone = false;
+    for (unsigned int i=0U; i<n; i++) {
+      T* ci = static_cast<T*>(root->clone());
+      ci->component(i);
+      e[i] = build<T,E>(ci,opt);
+    }
+  }
+
+  template<class T, template<class> class E>
+  Space*
+  AndOrEngine<T,E>::get(unsigned int i, int j) {
+    while (s[i].entries() <= j) {
+      if (x[i])
+        return NULL;
+      Space* b = e[i]->next();
+      if (b == NULL) {
+        x[i] = !e[i]->stopped();
+        return NULL;
+      }
+      if (E<T>::best)
+        while (!s[i].empty())
+          delete s[i].pop();
+      s[i].push(b);
+      if (E<T>::best)
+        // Only the best solution is kept
+        j = 0;
+    }
+    return s[i][j];
+  }
+
+  template<class T, template<class> class E>
+  bool
+  AndOrEngine<T,E>::advance(void) {
+    while (a < n) {
+      if (get(a,cur[a]+1) != NULL) {
+        cur[a]++; a = 0U;
+        return true;
+      }
+      if (!x[a])
+        // Stopped, continue with the same component later
+        return false;
+      cur[a] = 0; a++;
+    }
+    done = true;
+    return false;
+  }
+
+  template<class T, template<class> class E>
+  Space*
+  AndOrEngine<T,E>::combine(void) {
+    T* c = static_cast<T*>(root->clone());
+    for (unsigned int i=0U; i<n; i++)
+      c->combine(i,*static_cast<T*>(s[i][cur[i]]));
+    // Assign the remaining variables, if any
+    Engine* d = build<T,DFS>(c,opt);
+    Space* r = d->next();
+    stat += d->statistics();
+    delete d;
+    return r;
+  }
+
+  template<class T, template<class> class E>
+  Space*
+  AndOrEngine<T,E>::next(void) {
+    if (done)
+      return NULL;
+    if (E<T>::best) {
+      // Find the best solution of all components
+      for (unsigned int i=0U; i<n; i++) {
+        while (!x[i] && (get(i,s[i].entries()) != NULL)) {}
+        if (!x[i])
+          return NULL;
+      }
+      done = true;
+      for (unsigned int i=0U; i<n; i++)
+        if (s[i].empty())
+          return NULL;
+      return combine();
+    }
+    if (first) {
+      // Find a first solution for each component
+      while (a < n) {
+        if (get(a,0) == NULL) {
+          done = x[a];
+          return NULL;
+        }
+        a++;
+      }
+      a = 0U; first = false;
+      if (Space* c = combine())
+        return c;
+    }
+    while (advance())
+      if (Space* c = combine())
+        return c;
+    return NULL;
+  }
+
+  template<class T, template<class> class E>
+  Statistics
+  AndOrEngine<T,E>::statistics(void) const {
+    Statistics t(stat);
+    for (unsigned int i=0U; i<n; i++)
+      if (e[i] != NULL)
+        t += e[i]->statistics();
+    return t;
+  }
+
+  template<class T, template<class> class E>
+  bool
+  AndOrEngine<T,E>::stopped(void) const {
+    for (unsigned int i=0U; i<n; i++)
+      if ((e[i] != NULL) && e[i]->stopped())
+        return true;
+    return false;
+  }
+
+  template<class T, template<class> class E>
+  AndOrEngine<T,E>::~AndOrEngine(void) {
+    for (unsigned int i=0U; i<n; i++) {
+      delete e[i];
+      while (!s[i].empty())
+        delete s[i].pop();
+      s[i].~Solutions();
+    }
+    delete root;
+    heap.free<Engine*>(e,n);
+    heap.free<bool>(x,n);
+    heap.rfree(s);
+    heap.free<int>(cur,n);
+  }
+
+}}
+
+namespace Gecode {
+
+  template<class T, template<class> class E>
+  inline
+  AndOr<T,E>::AndOr(T* s, unsigned int n, const Search::Options& o)
+    : Search::Base<T>(new Search::AndOrEngine<T,E>(s,n,o)) {}
+
+  template<class T, template<class> class E>
+  inline T*
+  andor(T* s, unsigned int n, const Search::Options& o) {
+    AndOr<T,E> a(s,n,o);
+    return a.next();
+  }
+
+}
+
+// STATISTICS: search-other
@@ -0,0 +1,147 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2018
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  template<class T, template<class> class E>
+  forceinline
+  Async<T,E>::Monitor::Monitor(Search::Stop* so, Progress f_prog0,
+                               unsigned int ms0)
+    : Search::CancelStop(so), f_prog(f_prog0), ms(ms0) {
+    t.start();
+  }
+
+  template<class T, template<class> class E>
+  bool
+  Async<T,E>::Monitor::stop(const Search::Statistics& s,
+                            const Search::Options& o) {
+    // Only one thread reports progress, others do not wait
+    if (f_prog && m.tryacquire()) {
+      if (t.stop() >= ms) {
+        f_prog(s);
+        t.start();
+      }
+      m.release();
+    }
+    return Search::CancelStop::stop(s,o);
+  }
+
+  template<class T, template<class> class E>
+  forceinline
+  Async<T,E>::Job::Job(T* s0, const Search::Options& o,
+                       Solution f_sol0, Done f_done0, Async* a0)
+    : s(s0), opt(o), f_sol(f_sol0), f_done(f_done0), a(a0) {
+    opt.clone = false;
+    opt.stop = &a->monitor;
+  }
+
+  template<class T, template<class> class E>
+  Support::Terminator*
+  Async<T,E>::Job::terminator(void) const {
+    return a;
+  }
+
+  template<class T, template<class> class E>
+  void
+  Async<T,E>::Job::run(void) {
+    Search::Statistics stat;
+    bool stopped = false;
+    if (s != NULL) {
+      E<T> engine(s,opt);
+      while (T* t = engine.next())
+        f_sol(t);
+      stat = engine.statistics();
+      stopped = engine.stopped();
+    } else {
+      stat.fail++;
+    }
+    if (f_done)
+      f_done(stat,stopped);
+  }
+
+  template<class T, template<class> class E>
+  inline
+  Async<T,E>::Async(T* s, const Search::Options& o, Solution f_sol,
+                    Done f_done, Progress f_prog, unsigned int ms)
+    : monitor(o.stop,f_prog,ms), w(false) {
+    T* c;
+    if (!o.clone)
+      c = s;
+    else if (s->status() == SS_FAILED)
+      c = NULL;
+    else
+      c = static_cast<T*>(s->clone());
+    Support::Thread::run(new Job(c,o,f_sol,f_done,this));
+  }
+
+  template<class T, template<class> class E>
+  forceinline void
+  Async<T,E>::cancel(void) {
+    monitor.cancel();
+  }
+
+  template<class T, template<class> class E>
+  forceinline bool
+  Async<T,E>::cancelled(void) const {
+    return monitor.cancelled();
+  }
+
+  template<class T, template<class> class E>
+  inline void
+  Async<T,E>::wait(void) {
+    if (!w) {
+      e.wait();
+      w = true;
+    }
+  }
+
+  template<class T, template<class> class E>
+  void
+  Async<T,E>::terminated(void) {
+    e.signal();
+  }
+
+  template<class T, template<class> class E>
+  inline
+  Async<T,E>::~Async(void) {
+    cancel();
+    wait();
+  }
+
+}
+
+// STATISTICS: search-other
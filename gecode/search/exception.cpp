@@ -52,6 +52,9 @@ namespace Gecode { namespace Search {
   NoBest::NoBest(const char* l)
     : Exception(l,"Best solution search is not supported") {}
 
+  ZeroNeighbourhoods::ZeroNeighbourhoods(const char* l)
+    : Exception(l,"No neighbourhoods requested") {}
+
 }}
 
 // STATISTICS: search-other
@@ -66,6 +66,12 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     NoBest(const char* l);
   };
+  /// %Exception: No neighbourhoods requested for adaptive large neighbourhood search
+  class GECODE_SEARCH_EXPORT ZeroNeighbourhoods : public Exception {
+  public:
+    /// Initialize with location \a l
+    ZeroNeighbourhoods(const char* l);
+  };
   //@}
 }}
 
@@ -0,0 +1,117 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2018
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  template<class T, template<class> class E>
+  inline
+  Incremental<T,E>::Incremental(T* s, const Search::Options& o)
+    : r(NULL), opt(o.expand()) {
+    opt.clone = false;
+    if (s->status(stat) == SS_FAILED) {
+      stat.fail++;
+      if (!o.clone)
+        delete s;
+    } else {
+      r = o.clone ? static_cast<T*>(s->clone()) : s;
+    }
+  }
+
+  template<class T, template<class> class E>
+  forceinline bool
+  Incremental<T,E>::failed(void) const {
+    return r == NULL;
+  }
+
+  template<class T, template<class> class E>
+  forceinline T*
+  Incremental<T,E>::clone(void) const {
+    return (r == NULL) ? NULL : static_cast<T*>(r->clone());
+  }
+
+  template<class T, template<class> class E>
+  inline void
+  Incremental<T,E>::update(T* s) {
+    delete r;
+    if ((s == NULL) || (s->status(stat) == SS_FAILED)) {
+      delete s;
+      r = NULL;
+    } else {
+      r = s;
+    }
+  }
+
+  template<class T, template<class> class E>
+  inline T*
+  Incremental<T,E>::solve(T* s) {
+    if (s == NULL) {
+      stat = Search::Statistics();
+      stat.fail++;
+      return NULL;
+    }
+    E<T> e(s,opt);
+    T* b = NULL;
+    while (T* n = e.next()) {
+      delete b; b = n;
+      if (!E<T>::best)
+        break;
+    }
+    stat = e.statistics();
+    return b;
+  }
+
+  template<class T, template<class> class E>
+  forceinline T*
+  Incremental<T,E>::solve(void) {
+    return solve(clone());
+  }
+
+  template<class T, template<class> class E>
+  forceinline Search::Statistics
+  Incremental<T,E>::statistics(void) const {
+    return stat;
+  }
+
+  template<class T, template<class> class E>
+  inline
+  Incremental<T,E>::~Incremental(void) {
+    delete r;
+  }
+
+}
+
+// STATISTICS: search-other
@@ -102,6 +102,11 @@ namespace Gecode { namespace Search {
 
   ExecStatus
   NoGoodsProp::propagate(Space& home, const ModEventDelta&) {
+    // Delete no-goods that have not pruned for too long
+    if ((activity != NULL) && activity->inactive())
+      return home.ES_SUBSUMED(*this);
+    // Whether the no-goods pruned
+    bool pruned = false;
   restart:
     // Start with checking the first literal
     switch (root->status(home)) {
@@ -115,6 +120,7 @@ namespace Gecode { namespace Search {
         while ((l != NULL) && l->leaf()) {
           l->cancel(home,*this); n--;
           GECODE_ES_CHECK(l->prune(home));
+          pruned = true;
           l = disposenext(l,home,*this,false);
         }
         root = l;
@@ -150,6 +156,7 @@ namespace Gecode { namespace Search {
           l = disposenext(l,home,*this,true); n--;
           p->next(l);
           GECODE_ES_CHECK(root->prune(home));
+          pruned = true;
           if (root->status(home) == NGL::FAILED)
             return home.ES_SUBSUMED(*this);
           break;
@@ -193,6 +200,8 @@ namespace Gecode { namespace Search {
         }
       }
     }
+    if (activity != NULL)
+      activity->update(pruned);
     return ES_NOFIX;
   }
 
@@ -216,6 +225,8 @@ namespace Gecode { namespace Search {
       while (l != NULL)
         l = disposenext(l,home,*this,false);
     }
+    if ((activity != NULL) && activity->rc.dec())
+      delete activity;
     home.ignore(*this,AP_DISPOSE,true);
     (void) Propagator::dispose(home);
     return sizeof(*this);
@@ -68,12 +68,34 @@ namespace Gecode { namespace Search {
   /// No-good propagator
   class GECODE_SEARCH_EXPORT NoGoodsProp : public Propagator {
   protected:
+    /// Activity shared by all copies of a no-good propagator
+    class Activity {
+    public:
+      /// Reference count for all copies of the propagator
+      Support::RefCount rc;
+      /// Current activity
+      std::atomic_uint a;
+      /// Activity after pruning
+      unsigned int reset;
+      /// Initialize with activity \a a
+      Activity(unsigned int a);
+      /// Update after propagation, \a pruned tells whether it pruned
+      void update(bool pruned);
+      /// Whether the no-good can be deleted
+      bool inactive(void) const;
+      /// Allocate memory from heap
+      static void* operator new(size_t s);
+      /// Release memory to heap
+      static void operator delete(void* p);
+    };
     /// Root of no-good literal tree
     NGL* root;
     /// Number of no-good literals with subscriptions
     unsigned int n;
-    /// Constructor for creation
-    NoGoodsProp(Space& home, NGL* root);
+    /// Activity (NULL if no-goods are never deleted)
+    Activity* activity;
+    /// Constructor for creation with initial activity \a a
+    NoGoodsProp(Space& home, NGL* root, unsigned int a);
     /// Constructor for cloning \a p
     NoGoodsProp(Space& home, NoGoodsProp& p);
   public:
@@ -51,8 +51,41 @@ namespace Gecode { namespace Search {
 
 
   forceinline
-  NoGoodsProp::NoGoodsProp(Space& home, NGL* root0)
-    : Propagator(Home(home)), root(root0), n(0U) {
+  NoGoodsProp::Activity::Activity(unsigned int a0)
+    : rc(1), a(a0), reset(a0) {}
+
+  forceinline void
+  NoGoodsProp::Activity::update(bool pruned) {
+    if (pruned) {
+      a.store(reset,std::memory_order_relaxed);
+    } else {
+      unsigned int c = a.load(std::memory_order_relaxed);
+      if (c > 0U)
+        a.store(c-1U,std::memory_order_relaxed);
+    }
+  }
+
+  forceinline bool
+  NoGoodsProp::Activity::inactive(void) const {
+    return a.load(std::memory_order_relaxed) == 0U;
+  }
+
+  forceinline void*
+  NoGoodsProp::Activity::operator new(size_t s) {
+    return heap.ralloc(s);
+  }
+
+  forceinline void
+  NoGoodsProp::Activity::operator delete(void* p) {
+    heap.rfree(p);
+  }
+
+
+
+  forceinline
+  NoGoodsProp::NoGoodsProp(Space& home, NGL* root0, unsigned int a)
+    : Propagator(Home(home)), root(root0), n(0U),
+      activity((a > 0U) ? new Activity(a) : NULL) {
     // Create subscriptions
     root->subscribe(home,*this); n++;
     bool notice = root->notice();
@@ -69,14 +102,17 @@ namespace Gecode { namespace Search {
       notice = notice || l->notice();
       l = l->next();
     }
-    if (notice)
+    // The activity must be released when the space is deleted
+    if (notice || (activity != NULL))
       home.notice(*this,AP_DISPOSE);
   }
 
   forceinline
   NoGoodsProp::NoGoodsProp(Space& home, NoGoodsProp& p)
-    : Propagator(home,p), n(p.n) {
+    : Propagator(home,p), n(p.n), activity(p.activity) {
     assert(p.root != NULL);
+    if (activity != NULL)
+      activity->rc.inc();
     NoNGL s;
     NGL* c = &s;
     for (NGL* pc = p.root; pc != NULL; pc = pc->next()) {
@@ -171,7 +207,7 @@ namespace Gecode { namespace Search {
 
     const_cast<Path&>(p).ng(n_nogood);
 
-    (void) new (home) NoGoodsProp(home,nn.next());
+    (void) new (home) NoGoodsProp(home,nn.next(),p.nga());
     return ES_OK;
   }
 
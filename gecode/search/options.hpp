@@ -41,9 +41,10 @@ namespace Gecode { namespace Search {
   Options::Options(void)
     : clone(Config::clone),
       threads(Config::threads),
-      c_d(Config::c_d), a_d(Config::a_d),
+      c_d(Config::c_d), a_d(Config::a_d), handover(Config::handover),
       d_l(Config::d_l),
       assets(0), slice(Config::slice), nogoods_limit(0),
+      nogoods_activity(0),
       stop(nullptr), cutoff(nullptr), tracer(nullptr) {}
 
 }}
@@ -98,7 +98,8 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline
   Engine<Tracer>::Worker::Worker(Space* s, Engine& e)
     : tracer(e.opt().tracer), _engine(e),
-      path(s == NULL ? 0 : e.opt().nogoods_limit), d(0),
+      path(s == NULL ? 0 : e.opt().nogoods_limit,
+           e.opt().nogoods_activity), d(0),
       idle(false) {
     tracer.worker();
     if (s != NULL) {
@@ -277,7 +278,7 @@ namespace Gecode { namespace Search { namespace Par {
     if (!path.steal())
       return NULL;
     m.acquire();
-    Space* s = path.steal(*this,d,myt,ot);
+    Space* s = path.steal(*this,d,myt,ot,engine().opt().handover);
     m.release();
     // Tell that there will be one more busy worker
     if (s != NULL)
@@ -119,15 +119,19 @@ namespace Gecode { namespace Search { namespace Par {
     Support::DynamicStack<Edge,Heap> ds;
     /// Depth limit for no-good generation
     unsigned int _ngdl;
+    /// Initial activity of no-goods
+    unsigned int _nga;
     /// Number of edges that have work for stealing
     unsigned int n_work;
   public:
-    /// Initialize with no-good depth limit \a l
-    Path(unsigned int l);
+    /// Initialize with no-good depth limit \a l and activity \a a
+    Path(unsigned int l, unsigned int a);
     /// Return no-good depth limit
     unsigned int ngdl(void) const;
     /// Set no-good depth limit to \a l
     void ngdl(unsigned int l);
+    /// Return initial activity of no-goods
+    unsigned int nga(void) const;
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c, unsigned int nid);
     /// Generate path for next node
@@ -155,9 +159,14 @@ namespace Gecode { namespace Search { namespace Par {
     void reset(unsigned int l);
     /// Make a quick check whether stealing might be feasible
     bool steal(void) const;
-    /// Steal work at depth \a d
+    /**
+     * \brief Steal work at depth \a d
+     *
+     * If \a ho is true and there is another copy below, the copy
+     * on the path is handed over rather than cloned.
+     */
     Space* steal(Worker& stat, unsigned long int& d,
-                 Tracer& myt, Tracer& ot);
+                 Tracer& myt, Tracer& ot, bool ho);
     /// Post no-goods
     void virtual post(Space& home) const;
   };
@@ -129,8 +129,8 @@ namespace Gecode { namespace Search { namespace Par {
 
   template<class Tracer>
   forceinline
-  Path<Tracer>::Path(unsigned int l)
-    : ds(heap), _ngdl(l), n_work(0) {}
+  Path<Tracer>::Path(unsigned int l, unsigned int a)
+    : ds(heap), _ngdl(l), _nga(a), n_work(0) {}
 
   template<class Tracer>
   forceinline unsigned int
@@ -144,6 +144,12 @@ namespace Gecode { namespace Search { namespace Par {
     _ngdl = l;
   }
 
+  template<class Tracer>
+  forceinline unsigned int
+  Path<Tracer>::nga(void) const {
+    return _nga;
+  }
+
   template<class Tracer>
   forceinline const Choice*
   Path<Tracer>::push(Worker& stat, Space* s, Space* c, unsigned int nid) {
@@ -254,7 +260,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::steal(Worker& stat, unsigned long int& d,
-                      Tracer& myt, Tracer& ot) {
+                      Tracer& myt, Tracer& ot, bool ho) {
     // Find position to steal: leave sufficient work
     int n = ds.entries()-1;
     unsigned int w = 0;
@@ -267,7 +273,18 @@ namespace Gecode { namespace Search { namespace Par {
         // Find last copy
         while (ds[l].space() == NULL)
           l--;
-        Space* c = ds[l].space()->clone();
+        Space* c;
+        // Find copy below last copy
+        int k=l-1;
+        while (ho && (k >= 0) && (ds[k].space() == NULL))
+          k--;
+        if (ho && (k >= 0)) {
+          // Hand over last copy, remaining nodes can be recomputed from k
+          c = ds[l].space();
+          ds[l].space(NULL);
+        } else {
+          c = ds[l].space()->clone();
+        }
         // Recompute, if necessary
         for (int i=l; i<n; i++)
           commit(c,i);
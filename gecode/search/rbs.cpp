@@ -51,6 +51,14 @@ namespace Gecode { namespace Search { namespace Seq {
                    stat,opt,best);
   }
 
+  Engine*
+  alnsengine(Space* master, Stop* stop, Engine* slave,
+             const Search::Statistics& stat, const Options& opt,
+             bool best, unsigned int n) {
+    return new RBS(master,static_cast<RestartStop*>(stop), slave,
+                   stat,opt,best,new Neighbourhoods(n));
+  }
+
 
 }}}
 
@@ -41,6 +41,8 @@
 #include <gecode/kernel.hh>
 #include <gecode/search.hh>
 
+#include <algorithm>
+
 namespace Gecode { namespace Search {
 
   /// Relax variables in \a x from solution \a sx with probability \a p
@@ -49,6 +51,18 @@ namespace Gecode { namespace Search {
   relax(Home home, const VarArgs& x, const VarArgs& sx, Rnd r,
         double p, Post& post);
 
+  /// Relax groups \a g of variables in \a x from solution \a sx with probability \a p
+  template<class VarArgs, class Post>
+  forceinline void
+  relax(Home home, const VarArgs& x, const VarArgs& sx,
+        const PrimArgArray<int>& g, Rnd r, double p, Post& post);
+
+  /// Relax variables in \a x from solution \a sx guided by propagation
+  template<class VarArgs, class Post>
+  forceinline void
+  pgrelax(Home home, const VarArgs& x, const VarArgs& sx, Rnd r,
+          double p, Post& post);
+
 
   template<class VarArgs, class Post>
   forceinline void
@@ -74,6 +88,74 @@ namespace Gecode { namespace Search {
       }
   }
 
+  template<class VarArgs, class Post>
+  forceinline void
+  relax(Home home, const VarArgs& x, const VarArgs& sx,
+        const PrimArgArray<int>& g, Rnd r, double p, Post& post) {
+    if (home.failed() || (x.size() == 0))
+      return;
+    int n = 0;
+    for (int i=g.size(); i--; )
+      n = std::max(n,g[i]+1);
+    Region reg;
+    // Which groups to relax
+    Support::BitSet<Region> rg(reg, static_cast<unsigned int>(n));
+    // Select randomly with probability p to relax group
+    for (int j=n; j--; )
+      if (r(UINT_MAX) <
+          static_cast<unsigned int>(p * static_cast<double>(UINT_MAX)))
+        rg.set(static_cast<unsigned int>(j));
+    if (rg.none())
+      // Choose group of one variable uniformly and relax it
+      rg.set(static_cast<unsigned int>
+             (g[static_cast<int>(r(static_cast<unsigned int>(x.size())))]));
+    for (int i=0; i<x.size(); i++)
+      if (!rg.get(static_cast<unsigned int>(g[i])) &&
+          (post(home, x[i], sx[i]) != ES_OK)) {
+        home.failed();
+        return;
+      }
+  }
+
+  template<class VarArgs, class Post>
+  forceinline void
+  pgrelax(Home home, const VarArgs& x, const VarArgs& sx, Rnd r,
+          double p, Post& post) {
+    if (home.failed() || (x.size() == 0))
+      return;
+    Region reg;
+    int n = x.size();
+    // Random order in which variables are assigned
+    int* o = reg.alloc<int>(n);
+    for (int i=0; i<n; i++)
+      o[i] = i;
+    for (int i=n; i>1; i--)
+      std::swap(o[i-1],o[r(static_cast<unsigned int>(i))]);
+    // Number of variables to remain unassigned
+    int u = std::max(1,static_cast<int>(p * static_cast<double>(n)));
+    // Number of unassigned variables
+    int a = 0;
+    for (int i=0; i<n; i++)
+      if (!x[i].assigned())
+        a++;
+    // Assign variables and propagate until few enough are unassigned
+    for (int k=0; (k<n) && (a > u); k++) {
+      int i = o[k];
+      if (x[i].assigned())
+        continue;
+      if (post(home, x[i], sx[i]) != ES_OK) {
+        home.failed();
+        return;
+      }
+      if (static_cast<Space&>(home).status() == SS_FAILED)
+        return;
+      a = 0;
+      for (int j=0; j<n; j++)
+        if (!x[j].assigned())
+          a++;
+    }
+  }
+
 }}
 
 #endif
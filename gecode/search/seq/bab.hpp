@@ -44,7 +44,8 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   BAB<Tracer>::BAB(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0), mark(0), 
+    : tracer(o.tracer), opt(o),
+      path(opt.nogoods_limit,opt.nogoods_activity), d(0), mark(0),
       best(NULL) {
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::BAB, 1U);
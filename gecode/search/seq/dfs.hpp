@@ -40,7 +40,8 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   DFS<Tracer>::DFS(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0) {
+    : tracer(o.tracer), opt(o),
+      path(opt.nogoods_limit,opt.nogoods_activity), d(0) {
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::DFS, 1U);
       tracer.worker();
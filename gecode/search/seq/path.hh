@@ -115,13 +115,17 @@ namespace Gecode { namespace Search { namespace Seq {
     Support::DynamicStack<Edge,Heap> ds;
     /// Depth limit for no-good generation
     unsigned int _ngdl;
+    /// Initial activity of no-goods
+    unsigned int _nga;
   public:
-    /// Initialize with no-good depth limit \a l
-    Path(unsigned int l);
+    /// Initialize with no-good depth limit \a l and activity \a a
+    Path(unsigned int l, unsigned int a);
     /// Return no-good depth limit
     unsigned int ngdl(void) const;
     /// Set no-good depth limit to \a l
     void ngdl(unsigned int l);
+    /// Return initial activity of no-goods
+    unsigned int nga(void) const;
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c, unsigned int nid);
     /// Generate path for next node
@@ -120,8 +120,8 @@ namespace Gecode { namespace Search { namespace Seq {
 
   template<class Tracer>
   forceinline
-  Path<Tracer>::Path(unsigned int l)
-    : ds(heap), _ngdl(l) {}
+  Path<Tracer>::Path(unsigned int l, unsigned int a)
+    : ds(heap), _ngdl(l), _nga(a) {}
 
   template<class Tracer>
   forceinline unsigned int
@@ -135,6 +135,12 @@ namespace Gecode { namespace Search { namespace Seq {
     _ngdl = l;
   }
 
+  template<class Tracer>
+  forceinline unsigned int
+  Path<Tracer>::nga(void) const {
+    return _nga;
+  }
+
   template<class Tracer>
   forceinline const Choice*
   Path<Tracer>::push(Worker& stat, Space* s, Space* c, unsigned int nid) {
@@ -38,6 +38,8 @@
 
 #include <gecode/search/seq/rbs.hh>
 
+#include <algorithm>
+
 namespace Gecode { namespace Search { namespace Seq {
 
   bool
@@ -56,6 +58,44 @@ namespace Gecode { namespace Search { namespace Seq {
     return false;
   }
 
+  Neighbourhoods::Neighbourhoods(unsigned int n0)
+    : n(n0), w(heap.alloc<double>(n0)), c(0U), p(Config::alns_relax) {
+    for (unsigned int i=0U; i<n; i++)
+      w[i] = 1.0;
+  }
+
+  void
+  Neighbourhoods::update(Outcome o) {
+    // Update weight of current neighbourhood
+    w[c] = Config::alns_decay * w[c] +
+      ((o == IMPROVED) ? (1.0 - Config::alns_decay) : 0.0);
+    if (w[c] < Config::alns_weight)
+      w[c] = Config::alns_weight;
+    // Too small neighbourhoods are enlarged, too large are shrunk
+    if (o == EXHAUSTED)
+      p = std::min(p * Config::alns_adapt, 1.0);
+    else if (o == LIMIT)
+      p = std::max(p / Config::alns_adapt, 0.01);
+    // Select next neighbourhood with probability proportional to weight
+    double t = 0.0;
+    for (unsigned int i=0U; i<n; i++)
+      t += w[i];
+    double r = t * static_cast<double>(rg(UINT_MAX)) /
+      static_cast<double>(UINT_MAX);
+    c = n-1U;
+    for (unsigned int i=0U; i<n-1U; i++)
+      if (r < w[i]) {
+        c = i; break;
+      } else {
+        r -= w[i];
+      }
+  }
+
+  Neighbourhoods::~Neighbourhoods(void) {
+    heap.free<double>(w,n);
+  }
+
+
   Space*
   RBS::next(void) {
     if (restart) {
@@ -64,7 +104,9 @@ namespace Gecode { namespace Search { namespace Seq {
       NoGoods& ng = e->nogoods();
       // Reset number of no-goods found
       ng.ng(0);
-      MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
+      if (nh != NULL)
+        nh->update(Neighbourhoods::IMPROVED);
+      MetaInfo mi(metainfo(ng));
       bool r = master->master(mi);
       stop->m_stat.nogood += ng.ng();
       if (master->status(stop->m_stat) == SS_FAILED) {
@@ -95,10 +137,14 @@ namespace Gecode { namespace Search { namespace Seq {
                   (e->stopped() && stop->enginestopped()) ) {
         // The engine must perform a true restart
         // The number of the restart has been incremented in the stop object
+        if (nh != NULL)
+          nh->update((sslr > 0) ? Neighbourhoods::IMPROVED :
+                     (e->stopped() ? Neighbourhoods::LIMIT :
+                      Neighbourhoods::EXHAUSTED));
         sslr = 0;
         NoGoods& ng = e->nogoods();
         ng.ng(0);
-        MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
+        MetaInfo mi(metainfo(ng));
         (void) master->master(mi);
         stop->m_stat.nogood += ng.ng();
         long unsigned int nl = ++(*co);
@@ -157,6 +203,7 @@ namespace Gecode { namespace Search { namespace Seq {
     delete last;
     delete co;
     delete stop;
+    delete nh;
   }
 
 }}}
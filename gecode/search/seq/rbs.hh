@@ -72,6 +72,39 @@ namespace Gecode { namespace Search { namespace Seq {
     Statistics metastatistics(void) const;
   };
 
+  /// Adaptive selection of neighbourhoods and relaxation probability
+  class GECODE_SEARCH_EXPORT Neighbourhoods : public HeapAllocated {
+  public:
+    /// Outcome of a restart
+    enum Outcome {
+      IMPROVED,  ///< A solution has been found
+      EXHAUSTED, ///< The neighbourhood has been explored without solution
+      LIMIT      ///< The cutoff has been reached without solution
+    };
+  protected:
+    /// Number of neighbourhoods
+    unsigned int n;
+    /// Weights of neighbourhoods
+    double* w;
+    /// Current neighbourhood
+    unsigned int c;
+    /// Current relaxation probability
+    double p;
+    /// Random number generator
+    Support::RandomGenerator rg;
+  public:
+    /// Initialize for \a n neighbourhoods
+    Neighbourhoods(unsigned int n);
+    /// Update weights and relaxation probability after outcome \a o
+    void update(Outcome o);
+    /// Return current neighbourhood
+    unsigned int neighbourhood(void) const;
+    /// Return current relaxation probability
+    double relax(void) const;
+    /// Delete
+    ~Neighbourhoods(void);
+  };
+
   /// Engine for restart-based search
   class GECODE_SEARCH_EXPORT RBS : public Engine {
   protected:
@@ -95,10 +128,15 @@ namespace Gecode { namespace Search { namespace Seq {
     bool restart;
     /// Whether the engine performs best solution search
     bool best;
+    /// Neighbourhoods for adaptive large neighbourhood search (possibly NULL)
+    Neighbourhoods* nh;
+    /// Return meta information for a restart
+    MetaInfo metainfo(NoGoods& ng) const;
   public:
     /// Constructor
     RBS(Space* s, RestartStop* stop0, Engine* e0,
-        const Search::Statistics& stat, const Options& o, bool best);
+        const Search::Statistics& stat, const Options& o, bool best,
+        Neighbourhoods* nh=NULL);
     /// Return next solution (NULL, if none exists or search has been stopped)
     virtual Space* next(void);
     /// Return statistics
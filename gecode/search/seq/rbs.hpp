@@ -65,16 +65,35 @@ namespace Gecode { namespace Search { namespace Seq {
   }
 
 
+  forceinline unsigned int
+  Neighbourhoods::neighbourhood(void) const {
+    return c;
+  }
+  forceinline double
+  Neighbourhoods::relax(void) const {
+    return p;
+  }
+
+
   forceinline
   RBS::RBS(Space* s, RestartStop* stop0,
            Engine* e0, const Search::Statistics& stat, const Options& opt,
-           bool best0)
+           bool best0, Neighbourhoods* nh0)
     : e(e0), master(s), last(NULL), co(opt.cutoff), stop(stop0),
       sslr(0),
-      complete(true), restart(false), best(best0) {
+      complete(true), restart(false), best(best0), nh(nh0) {
     stop->limit(stat,(*co)());
   }
 
+  forceinline MetaInfo
+  RBS::metainfo(NoGoods& ng) const {
+    if (nh == NULL)
+      return MetaInfo(stop->m_stat.restart,sslr,e->statistics().fail,
+                      last,ng);
+    return MetaInfo(stop->m_stat.restart,sslr,e->statistics().fail,
+                    last,ng,nh->neighbourhood(),nh->relax());
+  }
+
 }}}
 
 // STATISTICS: search-seq
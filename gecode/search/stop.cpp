@@ -87,6 +87,16 @@ namespace Gecode { namespace Search {
   }
 
 
+  /*
+   * Stopping for cancellation
+   *
+   */
+  bool
+  CancelStop::stop(const Statistics& s, const Options& o) {
+    return cancelled() || ((so != NULL) && so->stop(s,o));
+  }
+
+
 }}
 
 // STATISTICS: search-other
@@ -111,6 +111,26 @@ namespace Gecode { namespace Search {
     t.start();
   }
 
+
+  /*
+   * Stopping for cancellation
+   *
+   */
+
+  forceinline
+  CancelStop::CancelStop(Stop* so0)
+    : c(false), so(so0) {}
+
+  forceinline void
+  CancelStop::cancel(void) {
+    c.store(true,std::memory_order_release);
+  }
+
+  forceinline bool
+  CancelStop::cancelled(void) const {
+    return c.load(std::memory_order_acquire);
+  }
+
 }}
 
 // STATISTICS: search-other
@@ -108,17 +108,17 @@ namespace Gecode { namespace Set { namespace Branch {
       case SetVarBranch::SEL_MERIT_MAX:
         return new (home) ViewSelMax<MeritFunction<SetView>>(home,svb);
       case SetVarBranch::SEL_MIN_MIN:
-        return new (home) ViewSelMin<MeritMin>(home,svb);
+        return new (home) ViewSelMinHeap<MeritMin>(home,svb);
       case SetVarBranch::SEL_MIN_MAX:
-        return new (home) ViewSelMax<MeritMin>(home,svb);
+        return new (home) ViewSelMaxHeap<MeritMin>(home,svb);
       case SetVarBranch::SEL_MAX_MIN:
-        return new (home) ViewSelMin<MeritMax>(home,svb);
+        return new (home) ViewSelMinHeap<MeritMax>(home,svb);
       case SetVarBranch::SEL_MAX_MAX:
-        return new (home) ViewSelMax<MeritMax>(home,svb);
+        return new (home) ViewSelMaxHeap<MeritMax>(home,svb);
       case SetVarBranch::SEL_SIZE_MIN:
-        return new (home) ViewSelMin<MeritSize>(home,svb);
+        return new (home) ViewSelMinHeap<MeritSize>(home,svb);
       case SetVarBranch::SEL_SIZE_MAX:
-        return new (home) ViewSelMax<MeritSize>(home,svb);
+        return new (home) ViewSelMaxHeap<MeritSize>(home,svb);
       case SetVarBranch::SEL_DEGREE_MIN:
         return new (home) ViewSelMin<MeritDegree<SetView>>(home,svb);
       case SetVarBranch::SEL_DEGREE_MAX:
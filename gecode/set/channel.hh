@@ -193,8 +193,18 @@ namespace Gecode { namespace Set { namespace Channel {
     GLBndSet zeros;
     /// Accumulated one Booleans
     GLBndSet ones;
+    /// Whether Booleans are accumulated as small sets
+    bool small;
+    /// Accumulated zero Booleans (if small)
+    SmallSet szeros;
+    /// Accumulated one Booleans (if small)
+    SmallSet sones;
     /// Flag whether propagation is currently running
     bool running;
+    /// Record that Boolean \a i is assigned to zero
+    void zero(Space& home, int i);
+    /// Record that Boolean \a i is assigned to one
+    void one(Space& home, int i);
   public:
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home);
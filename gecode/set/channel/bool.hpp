@@ -77,22 +77,44 @@ namespace Gecode { namespace Set { namespace Channel {
     Advisor::dispose(home,c);
   }
 
+  template<class View>
+  forceinline void
+  ChannelBool<View>::zero(Space& home, int i) {
+    if (small) {
+      szeros.include(i,i);
+    } else {
+      SetDelta d;
+      zeros.include(home, i, i, d);
+    }
+  }
+
+  template<class View>
+  forceinline void
+  ChannelBool<View>::one(Space& home, int i) {
+    if (small) {
+      sones.include(i,i);
+    } else {
+      SetDelta d;
+      ones.include(home, i, i, d);
+    }
+  }
+
   template<class View>
   forceinline
   ChannelBool<View>::ChannelBool(Home home,
                                  ViewArray<Gecode::Int::BoolView>& x0,
                                  View y0)
-    : Super(home,x0,y0), co(home), running(false) {
+    : Super(home,x0,y0), co(home),
+      small(SmallSet::fits(0,x0.size()-1)), szeros(0), sones(0),
+      running(false) {
       bool assigned = false;
       for (int i=x.size(); i--;) {
         if (x[i].zero()) {
           assigned = true;
-          SetDelta d;
-          zeros.include(home, i, i, d);
+          zero(home, i);
         } else if (x[i].one()) {
           assigned = true;
-          SetDelta d;
-          ones.include(home, i, i, d);
+          one(home, i);
         } else {
           (void) new (home) IndexAdvisor(home,*this,co,i);
         }
@@ -113,7 +135,7 @@ namespace Gecode { namespace Set { namespace Channel {
   template<class View>
   forceinline
   ChannelBool<View>::ChannelBool(Space& home, ChannelBool& p)
-    : Super(home,p), running(false) {
+    : Super(home,p), small(p.small), szeros(0), sones(0), running(false) {
     co.update(home, p.co);
   }
 
@@ -157,15 +179,28 @@ namespace Gecode { namespace Set { namespace Channel {
   ExecStatus
   ChannelBool<View>::propagate(Space& home, const ModEventDelta&) {
     running = true;
-    if (zeros.size() > 0) {
-      BndSetRanges zi(zeros);
-      GECODE_ME_CHECK(y.excludeI(home, zi));
-      zeros.init(home);
-    }
-    if (ones.size() > 0) {
-      BndSetRanges oi(ones);
-      GECODE_ME_CHECK(y.includeI(home, oi));
-      ones.init(home);
+    if (small) {
+      if (!szeros.empty()) {
+        SmallSetRanges zi(szeros);
+        GECODE_ME_CHECK(y.excludeI(home, zi));
+        szeros.init(0);
+      }
+      if (!sones.empty()) {
+        SmallSetRanges oi(sones);
+        GECODE_ME_CHECK(y.includeI(home, oi));
+        sones.init(0);
+      }
+    } else {
+      if (zeros.size() > 0) {
+        BndSetRanges zi(zeros);
+        GECODE_ME_CHECK(y.excludeI(home, zi));
+        zeros.init(home);
+      }
+      if (ones.size() > 0) {
+        BndSetRanges oi(ones);
+        GECODE_ME_CHECK(y.includeI(home, oi));
+        ones.init(home);
+      }
     }
     running = false;
 
@@ -218,12 +253,10 @@ namespace Gecode { namespace Set { namespace Channel {
 
     if (index >= 0) {
       if (x[index].zero()) {
-        SetDelta dummy;
-        zeros.include(home, index, index, dummy);
+        zero(home, index);
       } else {
         assert(x[index].one());
-        SetDelta dummy;
-        ones.include(home, index, index, dummy);
+        one(home, index);
       }
       return home.ES_NOFIX_DISPOSE( co, a);
     }
@@ -281,6 +281,130 @@ namespace Gecode { namespace Set {
     const LUBndSet& operator =(const LUBndSet&);
   };
 
+  /**
+   * \brief Dense sets of integers over a small universe
+   *
+   * The universe of a small set consists of the \a bits consecutive
+   * integers starting at an offset chosen at initialization. The set is
+   * stored as a bitset of fixed width, hence combining two small sets
+   * over the same universe works word by word. Small sets require no
+   * memory management and are used by propagators for accumulating
+   * and combining bounds of set variables when the universe is small.
+   */
+  class SmallSet {
+  public:
+    /// Number of integers in the universe
+    static const int bits = 512;
+  protected:
+    /// Number of words
+    static const int words =
+      bits / static_cast<int>(Support::BitSetData::bpb);
+    /// Smallest integer of the universe
+    int o;
+    /// The words
+    Support::BitSetData w[words];
+    /// Return word with bits \a i to \a j set
+    static Support::BitSetData mask(unsigned int i, unsigned int j);
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /// Default constructor (yields an uninitialized set)
+    SmallSet(void);
+    /// Initialize as empty set over universe starting at \a o
+    SmallSet(int o);
+    /// Initialize as empty set over universe starting at \a o
+    void init(int o);
+    /// Test whether \f$\{i,\dots,j\}\f$ fits into a universe
+    static bool fits(int i, int j);
+    //@}
+
+    /// \name Value access
+    //@{
+    /// Return smallest integer of the universe
+    int offset(void) const;
+    /// Test whether set is empty
+    bool empty(void) const;
+    /// Return size of the set
+    unsigned int size(void) const;
+    /// Return smallest element (set must not be empty)
+    int min(void) const;
+    /// Return largest element (set must not be empty)
+    int max(void) const;
+    /// Test whether \a i is an element of this set
+    bool in(int i) const;
+    /// Return smallest element not less than \a i (or offset()+bits)
+    int next(int i) const;
+    /// Return smallest integer not less than \a i not in the set
+    int nextout(int i) const;
+    //@}
+
+    /// \name Update operations
+    //@{
+    /// Include the set \f$\{i,\dots,j\}\f$ restricted to the universe
+    void include(int i, int j);
+    /// Exclude the set \f$\{i,\dots,j\}\f$
+    void exclude(int i, int j);
+    /// Include the set represented by \a i restricted to the universe
+    template<class I> void includeI(I& i);
+    /// Include all elements of \a s
+    void unite(const SmallSet& s);
+    /// Exclude all elements not in \a s
+    void intersect(const SmallSet& s);
+    /// Exclude all elements in \a s
+    void minus(const SmallSet& s);
+    //@}
+
+    /// \name Set tests
+    //@{
+    /// Test whether this set is a subset of \a s
+    bool subset(const SmallSet& s) const;
+    /// Test whether this set and \a s are disjoint
+    bool disjoint(const SmallSet& s) const;
+    //@}
+  };
+
+  /**
+   * \brief Range iterator for small sets
+   *
+   */
+  class SmallSetRanges {
+  protected:
+    /// The set
+    const SmallSet* s;
+    /// Minimum of current range
+    int mi;
+    /// Maximum of current range
+    int ma;
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /// Default constructor
+    SmallSetRanges(void);
+    /// Initialize with small set \a s
+    SmallSetRanges(const SmallSet& s);
+    /// Initialize with small set \a s
+    void init(const SmallSet& s);
+    //@}
+
+    /// \name Iteration control
+    //@{
+    /// Test whether iterator is still at a range or done
+    bool operator ()(void) const;
+    /// Move iterator to next range (if possible)
+    void operator ++(void);
+    //@}
+
+    /// \name Range access
+    //@{
+    /// Return smallest value of range
+    int min(void) const;
+    /// Return largest value of range
+    int max(void) const;
+    /// Return width of range (distance between minimum and maximum)
+    unsigned int width(void) const;
+    //@}
+  };
+
   /*
    * Iterators
    *
@@ -422,6 +546,7 @@ namespace Gecode { namespace Set {
 }}
 
 #include <gecode/set/var-imp/integerset.hpp>
+#include <gecode/set/var-imp/small.hpp>
 #include <gecode/set/var-imp/iter.hpp>
 
 namespace Gecode { namespace Set {
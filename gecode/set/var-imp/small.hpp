@@ -0,0 +1,276 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2018
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Set {
+
+  /*
+   * Small sets
+   *
+   */
+
+  forceinline Support::BitSetData
+  SmallSet::mask(unsigned int i, unsigned int j) {
+    assert((i <= j) && (j < Support::BitSetData::bpb));
+    Support::BitSetData a; a.init(true);
+    Support::BitSetData l; l.init(false);
+    Support::BitSetData u; u.init(false);
+    l.o(a,i);
+    if (j+1 < Support::BitSetData::bpb)
+      u.o(a,j+1);
+    else
+      u = a;
+    return Support::BitSetData::a(u,~l);
+  }
+
+  forceinline
+  SmallSet::SmallSet(void) {}
+  forceinline void
+  SmallSet::init(int o0) {
+    o = o0;
+    for (int k=0; k<words; k++)
+      w[k].init(false);
+  }
+  forceinline
+  SmallSet::SmallSet(int o0) {
+    init(o0);
+  }
+  forceinline bool
+  SmallSet::fits(int i, int j) {
+    return (i > j) || (static_cast<long long int>(j) - i < bits);
+  }
+
+  forceinline int
+  SmallSet::offset(void) const {
+    return o;
+  }
+  forceinline bool
+  SmallSet::empty(void) const {
+    for (int k=0; k<words; k++)
+      if (!w[k].none())
+        return false;
+    return true;
+  }
+  forceinline unsigned int
+  SmallSet::size(void) const {
+    unsigned int s = 0;
+    for (int k=0; k<words; k++)
+      s += w[k].ones();
+    return s;
+  }
+  forceinline bool
+  SmallSet::in(int i) const {
+    if ((i < o) || (i - o >= bits))
+      return false;
+    unsigned int p = static_cast<unsigned int>(i - o);
+    return w[p / Support::BitSetData::bpb].get(p % Support::BitSetData::bpb);
+  }
+  forceinline int
+  SmallSet::next(int i) const {
+    unsigned int p = (i < o) ? 0U : static_cast<unsigned int>(i - o);
+    while (p < static_cast<unsigned int>(bits)) {
+      unsigned int k = p / Support::BitSetData::bpb;
+      unsigned int b = p % Support::BitSetData::bpb;
+      if (w[k](b))
+        return o + static_cast<int>(k * Support::BitSetData::bpb +
+                                    w[k].next(b));
+      p = (k+1) * Support::BitSetData::bpb;
+    }
+    return o + bits;
+  }
+  forceinline int
+  SmallSet::nextout(int i) const {
+    if ((i < o) || (i - o >= bits))
+      return i;
+    unsigned int p = static_cast<unsigned int>(i - o);
+    while (p < static_cast<unsigned int>(bits)) {
+      unsigned int k = p / Support::BitSetData::bpb;
+      unsigned int b = p % Support::BitSetData::bpb;
+      Support::BitSetData c = ~w[k];
+      if (c(b))
+        return o + static_cast<int>(k * Support::BitSetData::bpb +
+                                    c.next(b));
+      p = (k+1) * Support::BitSetData::bpb;
+    }
+    return o + bits;
+  }
+  forceinline int
+  SmallSet::min(void) const {
+    assert(!empty());
+    return next(o);
+  }
+  forceinline int
+  SmallSet::max(void) const {
+    assert(!empty());
+    for (int k=words; k--; )
+      if (!w[k].none()) {
+        unsigned int p = w[k].next(0);
+        while ((p+1 < Support::BitSetData::bpb) && w[k](p+1))
+          p = w[k].next(p+1);
+        return o + static_cast<int>(k * Support::BitSetData::bpb + p);
+      }
+    GECODE_NEVER;
+    return 0;
+  }
+
+  forceinline void
+  SmallSet::include(int i, int j) {
+    i = std::max(i,o); j = std::min(j,o+bits-1);
+    if (i > j)
+      return;
+    unsigned int p = static_cast<unsigned int>(i - o);
+    unsigned int q = static_cast<unsigned int>(j - o);
+    unsigned int kp = p / Support::BitSetData::bpb;
+    unsigned int kq = q / Support::BitSetData::bpb;
+    if (kp == kq) {
+      w[kp].o(mask(p % Support::BitSetData::bpb,
+                   q % Support::BitSetData::bpb));
+    } else {
+      w[kp].o(mask(p % Support::BitSetData::bpb,
+                   Support::BitSetData::bpb-1));
+      for (unsigned int k=kp+1; k<kq; k++)
+        w[k].init(true);
+      w[kq].o(mask(0,q % Support::BitSetData::bpb));
+    }
+  }
+  forceinline void
+  SmallSet::exclude(int i, int j) {
+    i = std::max(i,o); j = std::min(j,o+bits-1);
+    if (i > j)
+      return;
+    unsigned int p = static_cast<unsigned int>(i - o);
+    unsigned int q = static_cast<unsigned int>(j - o);
+    unsigned int kp = p / Support::BitSetData::bpb;
+    unsigned int kq = q / Support::BitSetData::bpb;
+    if (kp == kq) {
+      w[kp].a(~mask(p % Support::BitSetData::bpb,
+                    q % Support::BitSetData::bpb));
+    } else {
+      w[kp].a(~mask(p % Support::BitSetData::bpb,
+                    Support::BitSetData::bpb-1));
+      for (unsigned int k=kp+1; k<kq; k++)
+        w[k].init(false);
+      w[kq].a(~mask(0,q % Support::BitSetData::bpb));
+    }
+  }
+  template<class I>
+  forceinline void
+  SmallSet::includeI(I& i) {
+    for (; i() && (i.min() - o < bits); ++i)
+      if (i.max() >= o)
+        include(i.min(),i.max());
+  }
+  forceinline void
+  SmallSet::unite(const SmallSet& s) {
+    assert(o == s.o);
+    for (int k=0; k<words; k++)
+      w[k].o(s.w[k]);
+  }
+  forceinline void
+  SmallSet::intersect(const SmallSet& s) {
+    assert(o == s.o);
+    for (int k=0; k<words; k++)
+      w[k].a(s.w[k]);
+  }
+  forceinline void
+  SmallSet::minus(const SmallSet& s) {
+    assert(o == s.o);
+    for (int k=0; k<words; k++)
+      w[k].a(~s.w[k]);
+  }
+
+  forceinline bool
+  SmallSet::subset(const SmallSet& s) const {
+    assert(o == s.o);
+    for (int k=0; k<words; k++)
+      if (!Support::BitSetData::a(w[k],~s.w[k]).none())
+        return false;
+    return true;
+  }
+  forceinline bool
+  SmallSet::disjoint(const SmallSet& s) const {
+    assert(o == s.o);
+    for (int k=0; k<words; k++)
+      if (!Support::BitSetData::a(w[k],s.w[k]).none())
+        return false;
+    return true;
+  }
+
+
+  /*
+   * Range iterator for small sets
+   *
+   */
+
+  forceinline
+  SmallSetRanges::SmallSetRanges(void) {}
+  forceinline void
+  SmallSetRanges::init(const SmallSet& s0) {
+    s = &s0;
+    mi = s->next(s->offset());
+    if (mi - s->offset() < SmallSet::bits)
+      ma = s->nextout(mi) - 1;
+  }
+  forceinline
+  SmallSetRanges::SmallSetRanges(const SmallSet& s0) {
+    init(s0);
+  }
+  forceinline bool
+  SmallSetRanges::operator ()(void) const {
+    return mi - s->offset() < SmallSet::bits;
+  }
+  forceinline void
+  SmallSetRanges::operator ++(void) {
+    mi = s->next(ma+1);
+    if (mi - s->offset() < SmallSet::bits)
+      ma = s->nextout(mi) - 1;
+  }
+  forceinline int
+  SmallSetRanges::min(void) const {
+    return mi;
+  }
+  forceinline int
+  SmallSetRanges::max(void) const {
+    return ma;
+  }
+  forceinline unsigned int
+  SmallSetRanges::width(void) const {
+    return static_cast<unsigned int>(ma - mi + 1);
+  }
+
+}}
+
+// STATISTICS: set-var
@@ -60,15 +60,17 @@ namespace Gecode { namespace Support {
     Type** tos;
     /// Stack entries (terminated by NULL entry)
     Type*  stack[2*maxsize+1];
+    /// Remaining number of unbalanced partitions for entries
+    int budget[maxsize];
   public:
     /// Initialize stack as empty
     QuickSortStack(void);
     /// Test whether stack is empty
     bool empty(void) const;
-    /// Push two positions \a l and \a r
-    void push(Type* l, Type* r);
-    /// Pop two positions \a l and \a r
-    void pop(Type*& l, Type*& r);
+    /// Push two positions \a l and \a r with budget \a b
+    void push(Type* l, Type* r, int b);
+    /// Pop two positions \a l and \a r with budget \a b
+    void pop(Type*& l, Type*& r, int& b);
   };
 
   template<class Type>
@@ -85,14 +87,16 @@ namespace Gecode { namespace Support {
 
   template<class Type>
   forceinline void
-  QuickSortStack<Type>::push(Type* l, Type* r) {
+  QuickSortStack<Type>::push(Type* l, Type* r, int b) {
+    budget[(tos - &stack[1]) >> 1] = b;
     *(tos++) = l; *(tos++) = r;
   }
 
   template<class Type>
   forceinline void
-  QuickSortStack<Type>::pop(Type*& l, Type*& r) {
+  QuickSortStack<Type>::pop(Type*& l, Type*& r, int& b) {
     r = *(--tos); l = *(--tos);
+    b = budget[(tos - &stack[1]) >> 1];
   }
 
   /// Standard insertion sort
@@ -128,35 +132,139 @@ namespace Gecode { namespace Support {
     return i;
   }
 
-  /// Standard quick sort
+  /// Partitioning that also reports whether elements had to be swapped
+  template<class Type, class Less>
+  forceinline Type*
+  partition(Type* l, Type* r, Less &less, bool& swapped) {
+    Type* i = l-1;
+    Type* j = r;
+    Type v = *r;
+    swapped = false;
+    while (true) {
+      while (less(*(++i),v)) {}
+      while (less(v,*(--j))) if (j == l) break;
+      if (i >= j) break;
+      std::swap(*i,*j); swapped = true;
+    }
+    std::swap(*i,*r);
+    return i;
+  }
+
+  /// Insertion sort that gives up if too many elements must be moved
+  template<class Type, class Less>
+  forceinline bool
+  partialinsertion(Type* l, Type* r, Less &less) {
+    // Maximal number of element moves
+    const long int limit = 8;
+    long int moved = 0;
+    for (Type* i = l+1; i <= r; i++)
+      if (less(*i,*(i-1))) {
+        Type* j = i;
+        Type v = *i;
+        do {
+          *j = *(j-1); j--;
+        } while ((j > l) && less(v,*(j-1)));
+        *j = v;
+        moved += i-j;
+        if (moved > limit)
+          return false;
+      }
+    return true;
+  }
+
+  /// Restore heap property for element \a i of heap \a x with \a n elements
+  template<class Type, class Less>
+  forceinline void
+  siftdown(Type* x, long int i, long int n, Less &less) {
+    Type v = x[i];
+    while (2*i+1 < n) {
+      long int c = 2*i+1;
+      if ((c+1 < n) && less(x[c],x[c+1]))
+        c++;
+      if (!less(v,x[c]))
+        break;
+      x[i] = x[c]; i = c;
+    }
+    x[i] = v;
+  }
+
+  /// Standard heap sort
+  template<class Type, class Less>
+  inline void
+  heapsort(Type* l, Type* r, Less &less) {
+    long int n = r-l+1;
+    for (long int i=n/2; i--; )
+      siftdown(l,i,n,less);
+    for (long int i=n; --i > 0; ) {
+      std::swap(l[0],l[i]);
+      siftdown(l,0L,i,less);
+    }
+  }
+
+  /**
+   * \brief Pattern-defeating quick sort
+   *
+   * Leaves partitions with at most QuickSortCutoff elements unsorted.
+   * As suggested by Orson Peters (pattern-defeating quicksort, 2021),
+   * an unbalanced partition breaks up patterns in the input by swapping
+   * elements and, after too many unbalanced partitions, heap sort is
+   * used instead. A partition that required no swaps is likely to be
+   * sorted already and is finished by a partial insertion sort.
+   */
   template<class Type, class Less>
   inline void
   quicksort(Type* l, Type* r, Less &less) {
     QuickSortStack<Type> s;
+    // Number of unbalanced partitions until heap sort is used
+    int bad = 0;
+    for (long int n = r-l+1; n > 1; n >>= 1)
+      bad++;
     while (true) {
+      long int n = r-l+1;
       std::swap(*(l+((r-l) >> 1)),*(r-1));
       exchange(*l,*(r-1),less);
       exchange(*l,*r,less);
       exchange(*(r-1),*r,less);
-      Type* i = partition(l+1,r-1,less);
-      if (i-l > r-i) {
-        if (r-i > QuickSortCutoff) {
-          s.push(l,i-1); l=i+1; continue;
-        }
-        if (i-l > QuickSortCutoff) {
-          r=i-1; continue;
+      bool swapped;
+      Type* i = partition(l+1,r-1,less,swapped);
+      // Whether both partitions are sorted
+      bool sorted = false;
+      if ((i-l < n/8) || (r-i < n/8)) {
+        if (--bad <= 0) {
+          heapsort(l,r,less); sorted = true;
+        } else {
+          if (i-l > QuickSortCutoff) {
+            std::swap(*l,*(l+(i-l)/4));
+            std::swap(*(i-1),*(i-(i-l)/4));
+          }
+          if (r-i > QuickSortCutoff) {
+            std::swap(*(i+1),*(i+1+(r-i)/4));
+            std::swap(*r,*(r-(r-i)/4));
+          }
         }
-      } else {
-        if (i-l > QuickSortCutoff) {
-          s.push(i+1,r); r=i-1; continue;
-        }
-        if (r-i > QuickSortCutoff) {
-          l=i+1; continue;
+      } else if (!swapped) {
+        sorted = partialinsertion(l,i-1,less) && partialinsertion(i+1,r,less);
+      }
+      if (!sorted) {
+        if (i-l > r-i) {
+          if (r-i > QuickSortCutoff) {
+            s.push(l,i-1,bad); l=i+1; continue;
+          }
+          if (i-l > QuickSortCutoff) {
+            r=i-1; continue;
+          }
+        } else {
+          if (i-l > QuickSortCutoff) {
+            s.push(i+1,r,bad); r=i-1; continue;
+          }
+          if (r-i > QuickSortCutoff) {
+            l=i+1; continue;
+          }
         }
       }
       if (s.empty())
         break;
-      s.pop(l,r);
+      s.pop(l,r,bad);
     }
   }
 
@@ -169,6 +277,157 @@ namespace Gecode { namespace Support {
     }
   };
 
+  /**
+   * \brief Traits for sorting elements of type \a Type by order \a Less
+   *
+   * If the order is defined by an unsigned integer key, the traits can
+   * be specialized by defining \a keyed as true and the function
+   * \a key such that \a less(x,y) holds if and only if the key of
+   * \a x is smaller than the key of \a y. Then large arrays are sorted
+   * by radix sort.
+   *
+   * \ingroup FuncSupport
+   */
+  template<class Type, class Less>
+  class SortTraits {
+  public:
+    /// Type of keys
+    typedef unsigned int Key;
+    /// Whether the order is defined by keys
+    static const bool keyed = false;
+    /// Return key of \a x with respect to order \a less
+    static Key key(Less& less, const Type& x);
+  };
+
+  /// Sorting integers by key
+  template<>
+  class SortTraits<int,Less<int> > {
+  public:
+    /// Type of keys
+    typedef unsigned int Key;
+    /// Whether the order is defined by keys
+    static const bool keyed = true;
+    /// Return key of \a x with respect to order \a less
+    static Key key(Less<int>& less, const int& x);
+  };
+
+  /// Sorting unsigned integers by key
+  template<>
+  class SortTraits<unsigned int,Less<unsigned int> > {
+  public:
+    /// Type of keys
+    typedef unsigned int Key;
+    /// Whether the order is defined by keys
+    static const bool keyed = true;
+    /// Return key of \a x with respect to order \a less
+    static Key key(Less<unsigned int>& less, const unsigned int& x);
+  };
+
+  /**
+   * \brief Traits for orders that define keys themselves
+   *
+   * The order \a Less must define the type \a Key and a function
+   * \code Key key(const Type&) const \endcode returning the key of an
+   * element. SortTraits can then be specialized by inheriting from
+   * this class.
+   *
+   * \ingroup FuncSupport
+   */
+  template<class Type, class Less>
+  class KeySortTraits {
+  public:
+    /// Type of keys
+    typedef typename Less::Key Key;
+    /// Whether the order is defined by keys
+    static const bool keyed = true;
+    /// Return key of \a x with respect to order \a less
+    static Key key(Less& less, const Type& x);
+  };
+
+  template<class Type, class Less>
+  forceinline typename SortTraits<Type,Less>::Key
+  SortTraits<Type,Less>::key(Less&, const Type&) {
+    GECODE_NEVER;
+    return 0;
+  }
+
+  forceinline SortTraits<int,Less<int> >::Key
+  SortTraits<int,Less<int> >::key(Less<int>&, const int& x) {
+    return static_cast<unsigned int>(x) ^ (1U << (sizeof(int)*CHAR_BIT-1));
+  }
+
+  forceinline SortTraits<unsigned int,Less<unsigned int> >::Key
+  SortTraits<unsigned int,Less<unsigned int> >::key(Less<unsigned int>&,
+                                                    const unsigned int& x) {
+    return x;
+  }
+
+  template<class Type, class Less>
+  forceinline typename KeySortTraits<Type,Less>::Key
+  KeySortTraits<Type,Less>::key(Less& less, const Type& x) {
+    return less.key(x);
+  }
+
+  /// Perform radix sort only for at least that many elements
+  int const RadixSortCutoff = 2048;
+
+  /**
+   * \brief Least significant digit radix sort
+   *
+   * Sorts the \a n first elements of array \a x by the keys defined
+   * by SortTraits for order \a less, one byte at a time. Bytes for
+   * which all keys agree are skipped.
+   */
+  template<class Type, class Less>
+  inline void
+  radixsort(Type* x, int n, Less &less) {
+    typedef SortTraits<Type,Less> Traits;
+    typedef typename Traits::Key Key;
+    // Number of bytes per key
+    const int bytes = static_cast<int>(sizeof(Key));
+    // Keys of elements and buffer for keys
+    Key* kx = heap.alloc<Key>(2*n);
+    Key* ky = kx + n;
+    // Buffer for elements
+    Type* b = heap.alloc<Type>(n);
+    Type* y = b;
+    Type* z = x;
+    // Count the occurrences of all bytes
+    unsigned int c[bytes][256];
+    for (int d=bytes; d--; )
+      for (int i=256; i--; )
+        c[d][i] = 0;
+    // Whether the elements are sorted already
+    bool sorted = true;
+    for (int i=n; i--; ) {
+      kx[i] = Traits::key(less,x[i]);
+      if ((i+1 < n) && (kx[i] > kx[i+1]))
+        sorted = false;
+      for (int d=bytes; d--; )
+        c[d][(kx[i] >> (8*d)) & 255]++;
+    }
+    for (int d=0; !sorted && (d<bytes); d++) {
+      // Skip byte if all keys agree
+      if (c[d][(kx[0] >> (8*d)) & 255] == static_cast<unsigned int>(n))
+        continue;
+      unsigned int p = 0;
+      for (int i=0; i<256; i++) {
+        unsigned int t = c[d][i]; c[d][i] = p; p += t;
+      }
+      for (int i=0; i<n; i++) {
+        unsigned int j = c[d][(kx[i] >> (8*d)) & 255]++;
+        ky[j] = kx[i]; y[j] = z[i];
+      }
+      std::swap(kx,ky); std::swap(y,z);
+    }
+    // Copy back if the sorted elements are in the buffer
+    if (z != x)
+      for (int i=n; i--; )
+        x[i] = z[i];
+    heap.free<Key>(std::min(kx,ky),2*n);
+    heap.free<Type>(b,n);
+  }
+
   /**
    * \brief Insertion sort
    *
@@ -227,6 +486,9 @@ namespace Gecode { namespace Support {
    * The algorithm is largely based on the following book:
    * Robert Sedgewick, Algorithms in C++, 3rd edition, 1998, Addison Wesley.
    *
+   * If the order is defined by keys (see SortTraits), arrays with at
+   * least RadixSortCutoff elements are sorted by radix sort instead.
+   *
    * \ingroup FuncSupport
    */
   template<class Type, class Less>
@@ -235,6 +497,10 @@ namespace Gecode { namespace Support {
     if (n < 2)
       return;
     assert(!l(x[0],x[0]));
+    if (SortTraits<Type,Less>::keyed && (n >= RadixSortCutoff)) {
+      radixsort(x,n,l);
+      return;
+    }
     if (n > QuickSortCutoff)
       quicksort(x,x+n-1,l);
     insertion(x,x+n-1,l);
@@ -249,6 +515,9 @@ namespace Gecode { namespace Support {
    * The algorithm is largely based on the following book:
    * Robert Sedgewick, Algorithms in C++, 3rd edition, 1998, Addison Wesley.
    *
+   * Integer arrays with at least RadixSortCutoff elements are sorted
+   * by radix sort instead.
+   *
    * \ingroup FuncSupport
    */
   template<class Type>
@@ -258,6 +527,10 @@ namespace Gecode { namespace Support {
       return;
     Less<Type> l;
     assert(!l(x[0],x[0]));
+    if (SortTraits<Type,Less<Type> >::keyed && (n >= RadixSortCutoff)) {
+      radixsort(x,n,l);
+      return;
+    }
     if (n > QuickSortCutoff)
       quicksort(x,x+n-1,l);
     insertion(x,x+n-1,l);
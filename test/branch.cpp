@@ -233,7 +233,11 @@ namespace Test { namespace Branch {
     "INT_VAL_RANGE_MAX",
     "INT_VAL",
     "INT_VALUES_MIN",
-    "INT_VALUES_MAX"
+    "INT_VALUES_MAX",
+    "INT_VAL_SOL_MIN",
+    "INT_VAL_SOL_MED",
+    "INT_VAL_SOL_MAX",
+    "INT_VAL_SOL_RND"
   };
   /// Number of integer value selections
   const int n_int_val_branch =
@@ -243,7 +247,10 @@ namespace Test { namespace Branch {
     "BOOL_VAL_MIN",
     "BOOL_VAL_MAX",
     "BOOL_VAL_RND",
-    "BOOL_VAL"
+    "BOOL_VAL",
+    "BOOL_VAL_SOL_MIN",
+    "BOOL_VAL_SOL_MAX",
+    "BOOL_VAL_SOL_RND"
   };
   /// Number of Boolean value selections
   const int n_bool_val_branch =
@@ -372,7 +379,10 @@ namespace Test { namespace Branch {
     "FLOAT_VAL_SPLIT_MIN",
     "FLOAT_VAL_SPLIT_MAX",
     "FLOAT_VAL_SPLIT_RND",
-    "FLOAT_VAL"
+    "FLOAT_VAL",
+    "FLOAT_VAL_SOL_SPLIT_MIN",
+    "FLOAT_VAL_SOL_SPLIT_MAX",
+    "FLOAT_VAL_SOL_SPLIT_RND"
   };
   /// Number of float value selections
   const int n_float_val_branch =
@@ -472,6 +482,10 @@ namespace Test { namespace Branch {
           case  8: ivb = INT_VAL(&int_val); break;
           case  9: ivb = INT_VALUES_MIN(); break;
           case 10: ivb = INT_VALUES_MAX(); break;
+          case 11: ivb = INT_VAL_SOL_MIN(); break;
+          case 12: ivb = INT_VAL_SOL_MED(); break;
+          case 13: ivb = INT_VAL_SOL_MAX(); break;
+          case 14: ivb = INT_VAL_SOL_RND(r); break;
           }
 
           IntTestSpace* c = static_cast<IntTestSpace*>(root->clone());
@@ -636,6 +650,9 @@ namespace Test { namespace Branch {
           case  1: bvb = BOOL_VAL_MAX(); break;
           case  2: bvb = BOOL_VAL_RND(r); break;
           case  3: bvb = BOOL_VAL(&bool_val); break;
+          case  4: bvb = BOOL_VAL_SOL_MIN(); break;
+          case  5: bvb = BOOL_VAL_SOL_MAX(); break;
+          case  6: bvb = BOOL_VAL_SOL_RND(r); break;
           }
 
           BoolTestSpace* c = static_cast<BoolTestSpace*>(root->clone());
@@ -930,6 +947,9 @@ namespace Test { namespace Branch {
           case 1: fvb = FLOAT_VAL_SPLIT_MAX(); break;
           case 2: fvb = FLOAT_VAL_SPLIT_RND(r); break;
           case 3: fvb = FLOAT_VAL(&float_val); break;
+          case 4: fvb = FLOAT_VAL_SOL_SPLIT_MIN(); break;
+          case 5: fvb = FLOAT_VAL_SOL_SPLIT_MAX(); break;
+          case 6: fvb = FLOAT_VAL_SOL_SPLIT_RND(r); break;
           }
 
           FloatTestSpace* c = static_cast<FloatTestSpace*>(root->clone());
@@ -37,6 +37,8 @@
 
 #include "test/branch.hh"
 
+#include <gecode/search.hh>
+
 namespace Test { namespace Branch {
 
   /// %Test brancher with distinct propagator
@@ -64,6 +66,157 @@ namespace Test { namespace Branch {
   Int l_2("Large::2",d_large,2);
   Int l_3("Large::3",d_large,3);
 
+  /// %Test that view selection with a heap agrees with scanning
+  class Heap : public Test::Base {
+  protected:
+    /// Space with many variables
+    class HeapSpace : public Gecode::Space {
+    public:
+      /// The variables
+      Gecode::IntVarArray x;
+      /// Constructor for creation
+      HeapSpace(int n) : x(*this,n,0,9) {
+        for (int i=0; i<n; i++) {
+          int l = static_cast<int>(Base::rand(5));
+          Gecode::dom(*this, x[i], l, l+2+static_cast<int>(Base::rand(4)));
+          int j = (i + 1 + static_cast<int>(Base::rand(n-1))) % n;
+          Gecode::rel(*this, x[i], Gecode::IRT_NQ, x[j]);
+        }
+      }
+      /// Constructor for cloning \a s
+      HeapSpace(HeapSpace& s) : Gecode::Space(s) {
+        x.update(*this,s.x);
+      }
+      /// Copy during cloning
+      virtual Gecode::Space* copy(void) {
+        return new HeapSpace(*this);
+      }
+    };
+    /// Variable selection using a heap
+    Gecode::IntVarBranch h;
+    /// Variable selection by scanning
+    Gecode::IntVarBranch s;
+  public:
+    /// Create and register test
+    Heap(const std::string& n, Gecode::IntVarBranch h0,
+         Gecode::IntVarBranch s0)
+      : Test::Base("Branch::Int::Heap::"+n), h(h0), s(s0) {}
+    /// Run test
+    virtual bool run(void) {
+      using namespace Gecode;
+      int n = 2*Kernel::Config::view_sel_heap;
+      HeapSpace* r = new HeapSpace(n);
+      (void) r->status();
+      HeapSpace* hs = static_cast<HeapSpace*>(r->clone());
+      HeapSpace* ss = static_cast<HeapSpace*>(r->clone());
+      delete r;
+      branch(*hs, hs->x, h, INT_VAL_MIN());
+      branch(*ss, ss->x, s, INT_VAL_MIN());
+      // Both engines must explore the same nodes
+      Search::Options ho, so;
+      ho.c_d = so.c_d = 4;
+      ho.stop = Search::Stop::node(10000);
+      so.stop = Search::Stop::node(10000);
+      DFS<HeapSpace> he(hs,ho);
+      DFS<HeapSpace> se(ss,so);
+      for (int k=0; k<4; k++) {
+        HeapSpace* hsol = he.next();
+        HeapSpace* ssol = se.next();
+        bool ok = (hsol == NULL) == (ssol == NULL);
+        if (ok && (hsol != NULL))
+          for (int i=0; i<n; i++)
+            if (hsol->x[i].val() != ssol->x[i].val())
+              ok = false;
+        delete hsol; delete ssol;
+        if (!ok || (he.statistics().node != se.statistics().node)) {
+          delete ho.stop; delete so.stop;
+          return false;
+        }
+      }
+      delete ho.stop; delete so.stop;
+      return true;
+    }
+  };
+
+  /// Merit function for size
+  double size(const Gecode::Space&, Gecode::IntVar x, int) {
+    return static_cast<double>(x.size());
+  }
+  /// Merit function for minimum
+  double min(const Gecode::Space&, Gecode::IntVar x, int) {
+    return static_cast<double>(x.min());
+  }
+  /// Merit function for maximum
+  double max(const Gecode::Space&, Gecode::IntVar x, int) {
+    return static_cast<double>(x.max());
+  }
+
+  Heap h_size_min("Size::Min",Gecode::INT_VAR_SIZE_MIN(),
+                  Gecode::INT_VAR_MERIT_MIN(&size));
+  Heap h_size_max("Size::Max",Gecode::INT_VAR_SIZE_MAX(),
+                  Gecode::INT_VAR_MERIT_MAX(&size));
+  Heap h_min_min("Min::Min",Gecode::INT_VAR_MIN_MIN(),
+                 Gecode::INT_VAR_MERIT_MIN(&min));
+  Heap h_min_max("Min::Max",Gecode::INT_VAR_MIN_MAX(),
+                 Gecode::INT_VAR_MERIT_MAX(&min));
+  Heap h_max_min("Max::Min",Gecode::INT_VAR_MAX_MIN(),
+                 Gecode::INT_VAR_MERIT_MIN(&max));
+  Heap h_max_max("Max::Max",Gecode::INT_VAR_MAX_MAX(),
+                 Gecode::INT_VAR_MERIT_MAX(&max));
+
+  /// %Test that value selection prefers values from the last solution
+  class Sol : public Test::Base {
+  protected:
+    /// Space with few variables
+    class SolSpace : public Gecode::Space {
+    public:
+      /// The variables
+      Gecode::IntVarArray x;
+      /// Constructor for creation
+      SolSpace(void) : x(*this,4,0,9) {}
+      /// Constructor for cloning \a s
+      SolSpace(SolSpace& s) : Gecode::Space(s) {
+        x.update(*this,s.x);
+      }
+      /// Copy during cloning
+      virtual Gecode::Space* copy(void) {
+        return new SolSpace(*this);
+      }
+    };
+    /// Value selection to test
+    Gecode::IntValBranch vb;
+  public:
+    /// Create and register test
+    Sol(const std::string& n, Gecode::IntValBranch vb0)
+      : Test::Base("Branch::Int::Sol::"+n), vb(vb0) {}
+    /// Run test
+    virtual bool run(void) {
+      using namespace Gecode;
+      SolSpace* r = new SolSpace;
+      branch(*r, r->x, INT_VAR_NONE(), vb);
+      // Find a solution with values not chosen by any fallback
+      SolSpace* c = static_cast<SolSpace*>(r->clone());
+      for (int i=0; i<c->x.size(); i++)
+        rel(*c, c->x[i], IRT_EQ, 2*i+1);
+      SolSpace* s = dfs(c);
+      delete c;
+      // Without constraints the first solution must be the same
+      SolSpace* t = dfs(r);
+      delete r;
+      bool ok = (s != NULL) && (t != NULL);
+      for (int i=0; ok && (i<t->x.size()); i++)
+        if (t->x[i].val() != 2*i+1)
+          ok = false;
+      delete s; delete t;
+      return ok;
+    }
+  };
+
+  Sol sol_min("Min",Gecode::INT_VAL_SOL_MIN());
+  Sol sol_med("Med",Gecode::INT_VAL_SOL_MED());
+  Sol sol_max("Max",Gecode::INT_VAL_SOL_MAX());
+  Sol sol_rnd("Rnd",Gecode::INT_VAL_SOL_RND(Gecode::Rnd(1U)));
+
 }}
 
 // STATISTICS: test-branch
@@ -617,6 +617,26 @@ if (!(T)) {                                                     \
         }
         delete s;
       }
+      START_TEST("Prune (measure cost)");
+      {
+        TestSpace* s = new TestSpace(arity,dom,this);
+        s->measure_cost(true);
+        s->post();
+        while (!s->failed() && !s->assigned())
+          if (!s->prune(a,testfix)) {
+            problem = "No fixpoint";
+            delete s;
+            goto failed;
+          }
+        s->assign(a);
+        if (sol) {
+          CHECK_TEST(!s->failed(), "Failed on solution");
+          CHECK_TEST(s->propagators()==0, "No subsumption");
+        } else {
+          CHECK_TEST(s->failed(), "Solved on non-solution");
+        }
+        delete s;
+      }
       START_TEST("Prune (disable)");
       {
         TestSpace* s = new TestSpace(arity,dom,this);
@@ -331,6 +331,8 @@ namespace Test { namespace Int {
           IntArgs s7(4, 1,3,3,4);
           IntArgs s8(6, 1,3,3,0,4,0);
           IntArgs s9(6, 1,2,4,8,16,32);
+          IntArgs s10(4, 3,5,5,7);
+          IntArgs s11(4, 40,30,20,5);
 
           for (int m=1; m<4; m++) {
             (void) new BPT(m, s0);
@@ -343,6 +345,8 @@ namespace Test { namespace Int {
             (void) new BPT(m, s7);
             (void) new BPT(m, s8);
             (void) new BPT(m, s9);
+            (void) new BPT(m, s10);
+            (void) new BPT(m, s11);
             (void) new BPT(m, s1, false);
           }
         }
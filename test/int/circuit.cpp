@@ -333,12 +333,21 @@ namespace Test { namespace Int {
            (void) new Circuit(i,0,i-1,0,Gecode::IPL_DOM);
            (void) new Circuit(i,0,i-1,5,Gecode::IPL_VAL);
            (void) new Circuit(i,0,i-1,5,Gecode::IPL_DOM);
+           (void) new Circuit(i,0,i-1,0,
+                              Gecode::IntPropLevel(Gecode::IPL_VAL |
+                                                   Gecode::IPL_BASIC));
+           (void) new Circuit(i,0,i-1,0,
+                              Gecode::IntPropLevel(Gecode::IPL_DOM |
+                                                   Gecode::IPL_BASIC));
          }
          for (int i=1; i<=4; i++) {
            (void) new Path(i,0,i-1,0,Gecode::IPL_VAL);
            (void) new Path(i,0,i-1,0,Gecode::IPL_DOM);
            (void) new Path(i,0,i-1,5,Gecode::IPL_VAL);
            (void) new Path(i,0,i-1,5,Gecode::IPL_DOM);
+           (void) new Path(i,0,i-1,5,
+                           Gecode::IntPropLevel(Gecode::IPL_DOM |
+                                                Gecode::IPL_BASIC));
          }
          (void) new CircuitCost(4,0,9,0,Gecode::IPL_VAL);
          (void) new CircuitCost(4,0,9,0,Gecode::IPL_DOM);
@@ -573,6 +573,104 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test with MDD created from tuple set
+     class MDDTest : public Test {
+     protected:
+       /// The tuple set to use
+       Gecode::TupleSet ts;
+       /// Whether to use Boolean variables
+       bool b;
+     public:
+       /// Create and register test
+       MDDTest(const std::string& s, Gecode::IntSet d0,
+               Gecode::TupleSet ts0, bool b0=false)
+         : Test("Extensional::MDD::TupleSet::"+s,
+                ts0.arity(),d0,false), ts(ts0), b(b0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         using namespace Gecode;
+         for (int i=ts.tuples(); i--; ) {
+           TupleSet::Tuple t = ts[i];
+           bool same = true;
+           for (int j=0; (j < ts.arity()) && same; j++)
+             if (t[j] != x[j])
+               same = false;
+           if (same)
+             return true;
+         }
+         return false;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         MDD m(ts);
+         if (b) {
+           BoolVarArgs y(x.size());
+           for (int i = x.size(); i--; )
+             y[i] = channel(home, x[i]);
+           extensional(home, y, m);
+         } else {
+           extensional(home, x, m);
+         }
+       }
+     };
+
+     /// %Test with MDD created from DFA (no two consecutive ones)
+     class MDDDFA : public Test {
+     public:
+       /// Create and register test
+       MDDDFA(int n) : Test("Extensional::MDD::DFA::"+str(n),n,0,2) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         for (int i=0; i<x.size(); i++)
+           if ((x[i] > 1) || ((i > 0) && (x[i-1] == 1) && (x[i] == 1)))
+             return false;
+         return true;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         DFA::Transition t[] = {
+           DFA::Transition(0,0,0), DFA::Transition(0,1,1),
+           DFA::Transition(1,0,0), DFA::Transition(-1,0,0)
+         };
+         int f[] = {0,1,-1};
+         DFA d(0,t,f);
+         MDD m(x.size(),d);
+         extensional(home, x, m);
+       }
+     };
+
+     /// %Test with MDD created from edges
+     class MDDEdges : public Test {
+     public:
+       /// Create and register test
+       MDDEdges(void) : Test("Extensional::MDD::Edges",3,0,3) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         return ((x[0] == 0) || (x[0] == 1)) &&
+           (((x[1] == 0) && (x[2] == 2)) || ((x[1] == 1) && (x[2] == 3)));
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         MDD::Edge e[] = {
+           // Nodes 1 and 2 in layer 1 are isomorphic, node 3 is a dead end
+           MDD::Edge(0,0,0,1), MDD::Edge(0,0,1,2), MDD::Edge(0,0,2,3),
+           MDD::Edge(1,1,0,1), MDD::Edge(1,1,1,2),
+           MDD::Edge(1,2,0,1), MDD::Edge(1,2,1,2),
+           // Node 5 in layer 1 is unreachable
+           MDD::Edge(1,5,3,1),
+           MDD::Edge(2,1,2,0), MDD::Edge(2,2,3,0),
+           MDD::Edge(-1,0,0,0)
+         };
+         MDD m(3,e);
+         assert((m.width(1) == 1) && (m.n_nodes() == 5) &&
+                (m.n_edges() == 6));
+         extensional(home, x, m);
+       }
+     };
+
      /// Help class to create and register tests with a fixed table size
      class TupleSetTestSize {
      public:
@@ -635,11 +733,13 @@ namespace Test { namespace Int {
              .add(1, 5, 2, 5).add(5, 3, 3, 2)
              .finalize();
            (void) new TupleSetTest("A",IntSet(0,6),ts,true);
+           (void) new MDDTest("A",IntSet(0,6),ts);
          }
          {
            TupleSet ts(4);
            ts.finalize();
            (void) new TupleSetTest("Empty",IntSet(1,2),ts,true);
+           (void) new MDDTest("Empty",IntSet(1,2),ts);
          }
          {
            TupleSet ts(4);
@@ -652,6 +752,7 @@ namespace Test { namespace Int {
            TupleSet ts(1);
            ts.add(1).add(2).add(3).finalize();
            (void) new TupleSetTest("Single",IntSet(-4,4),ts,true);
+           (void) new MDDTest("Single",IntSet(-4,4),ts);
          }
          {
            int m = Gecode::Int::Limits::min;
@@ -661,6 +762,7 @@ namespace Test { namespace Int {
              .add(m+1,m+2,m+5).add(m+2,m+3,m+0)
              .add(m+3,m+6,m+5).finalize();
            (void) new TupleSetTest("Min",IntSet(m,m+7),ts,true);
+           (void) new MDDTest("Min",IntSet(m,m+7),ts);
          }
          {
            int M = Gecode::Int::Limits::max;
@@ -670,6 +772,7 @@ namespace Test { namespace Int {
              .add(M-1,M-2,M-5).add(M-2,M-3,M-0)
              .add(M-3,M-6,M-5).finalize();
            (void) new TupleSetTest("Max",IntSet(M-7,M),ts,true);
+           (void) new MDDTest("Max",IntSet(M-7,M),ts);
          }
          {
            int m = Gecode::Int::Limits::min;
@@ -717,6 +820,7 @@ namespace Test { namespace Int {
            t.add(2,2,4,3,4);
            t.finalize();
            (void) new TupleSetTest("FewLast",IntSet(1,4),t,false);
+           (void) new MDDTest("FewLast",IntSet(1,4),t);
          }
          {
            TupleSet t(4);
@@ -728,6 +832,7 @@ namespace Test { namespace Int {
            t.add(2,-1,3,4);
            t.finalize();
            (void) new TupleSetTest("FewMiddle",IntSet(-1,6),t,false);
+           (void) new MDDTest("FewMiddle",IntSet(-1,6),t);
          }
          {
            TupleSet t(10);
@@ -746,6 +851,12 @@ namespace Test { namespace Int {
            t.finalize();
            (void) new RandomTupleSetTest("FewHuge",IntSet(1,4),t);
          }
+         {
+           TupleSet t(4);
+           t.add(0,0,1,1).add(0,1,0,1).add(1,0,0,1)
+             .add(1,1,1,0).add(0,0,0,0).finalize();
+           (void) new MDDTest("Bool",IntSet(0,1),t,true);
+         }
        }
      };
      
@@ -784,6 +895,11 @@ namespace Test { namespace Int {
      TupleSetLarge tsl(0.05);
 
      TupleSetBool tsbool(0.3);
+
+     MDDDFA mdfa1(1);
+     MDDDFA mdfa4(4);
+
+     MDDEdges medges;
      //@}
 
    }
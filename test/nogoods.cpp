@@ -217,6 +217,8 @@ namespace Test {
       bool a;
       /// Whether to also create branchers without no-good literals
       bool n;
+      /// Activity of no-goods before deletion
+      unsigned int g;
     public:
       /// Map unsigned integer to string
       static std::string str(unsigned int i) {
@@ -225,10 +227,12 @@ namespace Test {
         return s.str();
       }
       /// Initialize test
-      NoGoods(ValBranch vb0, unsigned int t0, bool a0, bool n0)
+      NoGoods(ValBranch vb0, unsigned int t0, bool a0, bool n0,
+              unsigned int g0=0U)
         : Base("NoGoods::"+Model::name()+"::"+Model::val(vb0)+"::"+str(t0)+
-               "::"+(a0 ? "+" : "-")+"::"+(n0 ? "+" : "-")),
-          vb(vb0), t(t0), a(a0), n(n0) {}
+               "::"+(a0 ? "+" : "-")+"::"+(n0 ? "+" : "-")+
+               ((g0 > 0U) ? "::"+str(g0) : "")),
+          vb(vb0), t(t0), a(a0), n(n0), g(g0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(vb,a,n);
@@ -241,6 +245,7 @@ namespace Test {
           o.stop = &ns;
           o.threads = t;
           o.nogoods_limit = 256U;
+          o.nogoods_activity = g;
           Search::Engine* e = Search::dfsengine(m,o);
           while (true) {
             Model* s = static_cast<Model*>(e->next());
@@ -284,6 +289,8 @@ namespace Test {
               (void) new NoGoods<Queens,IntValBranch>(INT_VAL_SPLIT_MAX(),t,a,n);
               (void) new NoGoods<Queens,IntValBranch>(INT_VALUES_MIN(),t,a,n);
               (void) new NoGoods<Queens,IntValBranch>(INT_VALUES_MAX(),t,a,n);
+              (void) new NoGoods<Queens,IntValBranch>(INT_VAL_MIN(),t,a,n,1U);
+              (void) new NoGoods<Queens,IntValBranch>(INT_VAL_MAX(),t,a,n,4U);
 #ifdef GECODE_HAS_SET_VARS
               (void) new NoGoods<Hamming,SetValBranch>(SET_VAL_MIN_INC(),t,a,n);
               (void) new NoGoods<Hamming,SetValBranch>(SET_VAL_MIN_EXC(),t,a,n);
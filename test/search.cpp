@@ -312,6 +312,85 @@ namespace Test {
       }
     };
 
+    /// Space with three independent components
+    class Components : public IntMinimizeSpace {
+    public:
+      /// Variables, three for each component
+      IntVarArray x;
+      /// Cost for each component
+      IntVarArray c;
+      /// Total cost
+      IntVar t;
+      /// Component (-1 for all components)
+      int i;
+      /// Constructor for space creation, \a b tells whether to branch
+      Components(bool b)
+        : x(*this,9,0,2), c(*this,3,0,100), t(*this,0,300), i(-1) {
+        for (int j=0; j<3; j++) {
+          IntVarArgs y(x.slice(3*j,1,3));
+          distinct(*this, y);
+          linear(*this, IntArgs::create(3,3-j,2), y, IRT_EQ, c[j]);
+        }
+        linear(*this, c, IRT_EQ, t);
+        if (b)
+          branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      Components(Components& s) : IntMinimizeSpace(s), i(s.i) {
+        x.update(*this, s.x);
+        c.update(*this, s.c);
+        t.update(*this, s.t);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new Components(*this);
+      }
+      /// Return cost
+      virtual IntVar cost(void) const {
+        return (i < 0) ? t : c[i];
+      }
+      /// Restrict to component \a j
+      void component(unsigned int j) {
+        i = static_cast<int>(j);
+        branch(*this, x.slice(3*i,1,3), INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Combine with solution \a s for component \a j
+      void combine(unsigned int j, const Components& s) {
+        for (int k=3*static_cast<int>(j); k<3*static_cast<int>(j+1); k++)
+          rel(*this, x[k], IRT_EQ, s.x[k].val());
+      }
+    };
+
+    /// Space with a group of constraints that can be enabled
+    class Optional : public Space {
+    public:
+      /// Variables
+      IntVarArray x;
+      /// Group of optional constraints
+      PropagatorGroup g;
+      /// Constructor for space creation
+      Optional(void) : x(*this,3,0,5) {
+        linear(Home(*this)(g), x, IRT_EQ, 6);
+        g.disable(*this);
+        branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      Optional(Optional& s) : Space(s), g(s.g) {
+        x.update(*this, s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new Optional(*this);
+      }
+      /// Test whether solution is \a x0, \a x1, \a x2 and delete it
+      static bool same(Optional* s, int x0, int x1, int x2) {
+        bool r = (s != NULL) && (s->x[0].val() == x0) &&
+          (s->x[1].val() == x1) && (s->x[2].val() == x2);
+        delete s;
+        return r;
+      }
+    };
+
     /// %Base class for search tests
     class Test : public Base {
     public:
@@ -368,14 +447,18 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Whether to hand over copies when stealing
+      bool ho;
     public:
       /// Initialize test
       DFS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          bool ho0=false)
         : Test("DFS::"+Model::name()+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+
+               (ho0 ? "::Handover" : ""),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0), ho(ho0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3);
@@ -384,6 +467,7 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.handover = ho;
         o.stop = &f;
         Gecode::DFS<Model> dfs(m,o);
         int n = m->solutions();
@@ -448,15 +532,19 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Whether to hand over copies when stealing
+      bool ho;
     public:
       /// Initialize test
       BAB(HowToConstrain htc,
           HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          bool ho0=false)
         : Test("BAB::"+Model::name()+"::"+str(htc)+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+
+               (ho0 ? "::Handover" : ""),
+               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0), ho(ho0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3,htc);
@@ -465,6 +553,7 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.handover = ho;
         o.stop = &f;
         Gecode::BAB<Model> bab(m,o);
         delete m;
@@ -520,6 +609,187 @@ namespace Test {
       }
     };
 
+    /// %Test for adaptive large neighbourhood search
+    template<class Model, template<class> class Engine>
+    class ALNS : public Test {
+    private:
+      /// Number of neighbourhoods
+      unsigned int n;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      ALNS(const std::string& e, unsigned int n0, unsigned int t0)
+        : Test("ALNS::"+e+"::"+Model::name()+"::"+str(n0)+"::"+str(t0),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), n(n0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.stop = &f;
+        o.d_l = 100;
+        o.cutoff = Gecode::Search::Cutoff::geometric(1,2);
+        Gecode::ALNS<Model,Engine> alns(m,n,o);
+        int s = m->solutions();
+        delete m;
+        while (true) {
+          Model* r = alns.next();
+          if (r != NULL) {
+            s--; delete r;
+          }
+          if ((r == NULL) && !alns.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        return s == 0;
+      }
+    };
+
+    /// %Test for incremental re-solving
+    class Incremental : public Test {
+    public:
+      /// Initialize test
+      Incremental(void)
+        : Test("Incremental",HTB_NONE,HTB_NONE,HTB_NONE) {}
+      /// Run test
+      virtual bool run(void) {
+        Gecode::Search::Options o;
+        o.clone = false;
+        Gecode::Incremental<Optional> inc(new Optional,o);
+        // Solve the root space
+        if (!Optional::same(inc.solve(),0,0,0))
+          return false;
+        // Enable the optional constraints
+        {
+          Optional* s = inc.clone();
+          s->g.enable(*s);
+          if (!Optional::same(inc.solve(s),0,1,5))
+            return false;
+        }
+        // Enable the optional constraints and fix a variable
+        {
+          Optional* s = inc.clone();
+          s->g.enable(*s);
+          rel(*s, s->x[0], IRT_EQ, 2);
+          if (!Optional::same(inc.solve(s),2,0,4))
+            return false;
+        }
+        // Change the root space permanently
+        {
+          Optional* s = inc.clone();
+          rel(*s, s->x[0], IRT_GQ, 1);
+          inc.update(s);
+          if (!Optional::same(inc.solve(),1,0,0))
+            return false;
+        }
+        // Fail the root space
+        {
+          Optional* s = inc.clone();
+          rel(*s, s->x[0], IRT_GR, 5);
+          inc.update(s);
+          if (!inc.failed() || (inc.solve() != NULL))
+            return false;
+        }
+        return true;
+      }
+    };
+
+    /// %Test for AND/OR search over independent components
+    template<template<class> class Engine>
+    class AndOr : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      AndOr(const std::string& e, unsigned int t0)
+        : Test("AndOr::"+e+"::"+str(t0),HTB_NONE,HTB_NONE,HTB_NONE),
+          t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Gecode::Search::Options o;
+        o.threads = t;
+        // Solve without decomposition
+        int n = 0;
+        Components* b = NULL;
+        {
+          Components* m = new Components(true);
+          Engine<Components> e(m,o);
+          delete m;
+          while (Components* s = e.next()) {
+            n++; delete b; b = s;
+          }
+        }
+        // Solve with decomposition
+        Components* m = new Components(false);
+        Gecode::AndOr<Components,Engine> e(m,3U,o);
+        delete m;
+        bool ok = true;
+        if (Engine<Components>::best) {
+          Components* s = e.next();
+          ok = (s != NULL) && (s->t.val() == b->t.val()) &&
+            (e.next() == NULL);
+          delete s;
+        } else {
+          while (Components* s = e.next()) {
+            n--; delete s;
+          }
+          ok = (n == 0);
+        }
+        delete b;
+        return ok;
+      }
+    };
+
+#ifdef GECODE_HAS_THREADS
+    /// %Test for asynchronous search
+    template<class Model>
+    class Async : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+      /// Whether to cancel search
+      bool c;
+    public:
+      /// Initialize test
+      Async(unsigned int t0, bool c0)
+        : Test("Async::"+Model::name()+"::"+str(t0)+"::"+
+               (c0 ? "Cancel" : "Run"),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), t(t0), c(c0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::Options o;
+        o.threads = t;
+        int n = 0;
+        unsigned long int p = 0;
+        bool done = false, stopped = false;
+        {
+          Gecode::Async<Model,Gecode::DFS>
+            a(m,o,
+              [&](Model* s) { n++; delete s; },
+              [&](const Gecode::Search::Statistics&, bool st) {
+                done = true; stopped = st;
+              },
+              [&](const Gecode::Search::Statistics&) { p++; },
+              0U);
+          if (c)
+            a.cancel();
+          a.wait();
+        }
+        int s = m->solutions();
+        delete m;
+        if (c)
+          // Search might have finished before being cancelled
+          return done && (stopped || (n == s));
+        return done && !stopped && (n == s) &&
+          ((p > 0) || (s == 0));
+      }
+    };
+#endif
+
     /// %Test for portfolio-based search
     template<class Model, template<class> class Engine>
     class PBS : public Test {
@@ -725,6 +995,10 @@ namespace Test {
                                       c_d, a_d, t);
               new DFS<HasSolutions>(HTB_NONE, HTB_NONE, HTB_NONE,
                                     c_d, a_d, t);
+              if (t > 1)
+                for (BranchTypes htb1; htb1(); ++htb1)
+                  (void) new DFS<HasSolutions>
+                    (htb1.htb(),htb1.htb(),htb1.htb(),c_d, a_d, t, true);
             }
 
         // Limited discrepancy search
@@ -756,6 +1030,12 @@ namespace Test {
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
+              if (t > 1)
+                for (ConstrainTypes htc; htc(); ++htc)
+                  for (BranchTypes htb1; htb1(); ++htb1)
+                    (void) new BAB<HasSolutions>
+                      (htc.htc(),htb1.htb(),htb1.htb(),htb1.htb(),
+                       c_d,a_d,t,true);
             }
         // Restart-based search
         for (unsigned int t=1; t<=4; t++) {
@@ -769,6 +1049,29 @@ namespace Test {
           (void) new RBS<SolveImmediate,Gecode::LDS>("LDS",t);
           (void) new RBS<SolveImmediate,Gecode::BAB>("BAB",t);
         }
+        // Adaptive large neighbourhood search
+        for (unsigned int n=1; n<=3; n++)
+          for (unsigned int t=1; t<=2; t++) {
+            (void) new ALNS<HasSolutions,Gecode::DFS>("DFS",n,t);
+            (void) new ALNS<FailImmediate,Gecode::DFS>("DFS",n,t);
+            (void) new ALNS<SolveImmediate,Gecode::DFS>("DFS",n,t);
+          }
+#ifdef GECODE_HAS_THREADS
+        // Asynchronous search
+        for (unsigned int t=1; t<=2; t++) {
+          (void) new Async<HasSolutions>(t,false);
+          (void) new Async<HasSolutions>(t,true);
+          (void) new Async<FailImmediate>(t,false);
+          (void) new Async<SolveImmediate>(t,false);
+        }
+#endif
+        // Incremental re-solving
+        (void) new Incremental;
+        // AND/OR search
+        for (unsigned int t=1; t<=2; t++) {
+          (void) new AndOr<Gecode::DFS>("DFS",t);
+          (void) new AndOr<Gecode::BAB>("BAB",t);
+        }
         // Portfolio-based search
         for (unsigned int a=1; a<=4; a++)
           for (unsigned int t=1; t<=2*a; t++) {
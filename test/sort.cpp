@@ -0,0 +1,113 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2018
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/support.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// %Test for sorting
+  class Sort : public Test::Base {
+  protected:
+    /// Largest number of elements to sort
+    static const int n_max = 3000;
+    /// Order that is not defined by keys
+    class Greater {
+    public:
+      /// Sort order
+      bool operator ()(const int& x, const int& y) {
+        return x > y;
+      }
+    };
+    /// Fill \a x with \a n elements according to pattern \a p
+    static void fill(int* x, int n, int p) {
+      for (int i=n; i--; )
+        switch (p) {
+        case 0: x[i] = static_cast<int>(rand(2000U)) - 1000; break;
+        case 1: x[i] = i; break;
+        case 2: x[i] = n-i; break;
+        case 3: x[i] = 7; break;
+        case 4: x[i] = (i < n/2) ? i : n-i; break;
+        default: x[i] = i % 17; break;
+        }
+    }
+    /// Test whether \a x with \a n elements is sorted by \a less
+    template<class Less>
+    static bool sorted(int* x, int n, Less& less) {
+      for (int i=1; i<n; i++)
+        if (less(x[i],x[i-1]))
+          return false;
+      return true;
+    }
+  public:
+    /// Initialize test
+    Sort(void) : Test::Base("Support::Sort") {}
+    /// Perform actual tests
+    bool run(void) {
+      using namespace Gecode;
+      int* x = heap.alloc<int>(n_max);
+      for (int p=0; p<6; p++)
+        for (int n=0; n<=n_max; n += 1 + static_cast<int>(rand(500U))) {
+          long long int s = 0;
+          fill(x,n,p);
+          for (int i=n; i--; )
+            s += x[i];
+          // Uses radix sort for larger arrays
+          Support::quicksort(x,n);
+          Support::Less<int> lt;
+          if (!sorted(x,n,lt))
+            return false;
+          Greater gt;
+          Support::quicksort(x,n,gt);
+          if (!sorted(x,n,gt))
+            return false;
+          for (int i=n; i--; )
+            s -= x[i];
+          if (s != 0)
+            return false;
+        }
+      heap.free<int>(x,n_max);
+      return true;
+    }
+  };
+
+  Sort s;
+
+}
+
+// STATISTICS: test-core